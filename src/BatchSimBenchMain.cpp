@@ -0,0 +1,204 @@
+// File: src/BatchSimBenchMain.cpp
+//
+// Allman braces. Explicit types.
+//
+// Greedy playout throughput: BatchSim lanes against GameImpl playing the same greedy policy
+// one game at a time (Restore + Resolve, the way a scalar rollout runs). Both engines play
+// the same seeded deals; the losers must agree, so a speedup never hides a rules drift.
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <print>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/BatchSim.hpp"
+#include "core/CardMasks.hpp"
+#include "core/ClassicRules.hpp"
+#include "core/Game.hpp"
+#include "core/Util.hpp"
+
+namespace
+{
+    using namespace durak::core;
+
+    struct CmdLine
+    {
+        uint32_t deals{4096}; // rounded up to whole batches
+        uint8_t players{2};
+        bool deck36{true};
+        uint64_t seed{1};
+    };
+
+    auto ParseArgs(int argc, char** argv) -> CmdLine
+    {
+        CmdLine c{};
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string const k = argv[i];
+            auto read_u64 = [&]() -> std::uint64_t
+            {
+                std::uint64_t v{};
+                if (i + 1 < argc)
+                {
+                    char const* s = argv[++i];
+                    std::from_chars(s, s + std::strlen(s), v);
+                }
+                return v;
+            };
+
+            if (k == "--deals") { c.deals = static_cast<uint32_t>(read_u64()); }
+            else if (k == "--players") { c.players = static_cast<uint8_t>(read_u64()); }
+            else if (k == "--deck52") { c.deck36 = false; }
+            else if (k == "--seed") { c.seed = read_u64(); }
+        }
+        return c;
+    }
+
+    auto Id(uint64_t const bit) -> uint8_t { return static_cast<uint8_t>(std::countr_zero(bit)); }
+
+    // BatchSim's greedy policy, read off GameImpl's masks.
+    auto GreedyAction(GameImpl const& g) -> PlayerAction
+    {
+        ZoneMasks const& m = g.Masks();
+        uint64_t const trumps = masks::SuitCards[std::to_underlying(g.Trump())];
+        PlyrIdxT const actor = g.CurrentActor();
+
+        uint64_t attacks = 0;
+        uint64_t uncovered = 0;
+        for (uint8_t slot = 0; slot < constants::MaxTableSlots; ++slot)
+        {
+            uint8_t const a = g.TableCard(slot, false);
+            if (a == StateImage::NoCard) continue;
+            attacks |= masks::CardBit(a);
+            if (g.TableCard(slot, true) == StateImage::NoCard) uncovered |= masks::CardBit(a);
+        }
+
+        if (g.PhaseNow() == Phase::Attacking)
+        {
+            bool const first = attacks == 0;
+            size_t const cap = first
+                                   ? std::min<size_t>(constants::MaxTableSlots, g.HandSize(g.Defender()))
+                                   : g.BoutCap();
+            uint64_t const same_rank = first ? ~uint64_t{0} : masks::CardsOfRanks(masks::RanksOf(m.table));
+            uint64_t const legal = static_cast<size_t>(std::popcount(attacks)) < cap ? m.hands[actor] & same_rank : 0;
+            uint64_t const pick = masks::Cheapest(legal, trumps);
+            if (pick == 0) return PassAction{};
+            return AttackAction{{g.FindFromHand(actor, util::UIDToCard(Id(pick)))}};
+        }
+
+        DefendAction d{};
+        uint64_t rest = m.hands[actor];
+        for (uint64_t todo = uncovered; todo != 0; todo &= todo - 1)
+        {
+            uint64_t const a = todo & (~todo + 1);
+            uint64_t const cover = masks::Cheapest(rest & masks::BeatersOf(a, trumps), trumps);
+            if (cover == 0) return TakeAction{};
+            rest &= ~cover;
+            d.pairs.push_back(DefendPair{g.FindFromAtkTable(util::UIDToCard(Id(a))),
+                                         g.FindFromHand(actor, util::UIDToCard(Id(cover)))});
+        }
+        return d;
+    }
+
+    auto LoserOf(GameImpl const& g) -> PlyrIdxT
+    {
+        PlyrIdxT fool = BatchSim::NoSeat;
+        size_t holders = 0;
+        for (PlyrIdxT s = 0; s < g.PlayerCount(); ++s)
+            if (g.HandSize(s) != 0)
+            {
+                fool = s;
+                ++holders;
+            }
+        return holders == 1 ? fool : BatchSim::NoSeat;
+    }
+
+    // Greedy play can cycle (4+ seats passing the same cards around); such games are cut off here
+    // and count as unfinished, NoSeat, on both engines.
+    constexpr uint32_t MaxSteps = 4000;
+}
+
+int main(int argc, char** argv)
+{
+    CmdLine const cl = ParseArgs(argc, argv);
+    if (cl.players < 2 || cl.players > constants::MaxPlayers || cl.deals == 0)
+    {
+        std::print(stderr, "[batchsim-bench] need 2..{} players and at least one deal\n", constants::MaxPlayers);
+        return 2;
+    }
+
+    size_t const batches = (cl.deals + BatchSim::Lanes - 1) / BatchSim::Lanes;
+    size_t const games = batches * BatchSim::Lanes;
+    Config const base{.n_players = cl.players, .deal_up_to = 6, .deck36 = cl.deck36, .seed = cl.seed};
+
+    std::vector<StateImage> deals;
+    deals.reserve(games);
+    for (size_t i = 0; i < games; ++i)
+    {
+        Config cfg = base;
+        cfg.seed = cl.seed + i;
+        deals.push_back(GameImpl(cfg, std::make_unique<ClassicRules>()).Capture());
+    }
+
+    std::print("[batchsim-bench] {} greedy games, {} players, deck={}, {} lanes\n",
+               games, cl.players, cl.deck36 ? 36 : 52, BatchSim::Lanes);
+
+    // BatchSim: one batch of lanes at a time
+    std::vector<PlyrIdxT> batch_losers(games);
+    uint64_t batch_plies = 0;
+    auto const b0 = std::chrono::steady_clock::now();
+    BatchSim sim(cl.players, base.deal_up_to);
+    for (size_t b = 0; b < batches; ++b)
+    {
+        for (size_t l = 0; l < BatchSim::Lanes; ++l) sim.Load(l, deals[b * BatchSim::Lanes + l]);
+        size_t live = BatchSim::Lanes;
+        for (uint32_t step = 0; step < MaxSteps && live != 0; ++step)
+        {
+            batch_plies += live;
+            live = sim.Step();
+        }
+        for (size_t l = 0; l < BatchSim::Lanes; ++l) batch_losers[b * BatchSim::Lanes + l] = sim.Loser(l);
+    }
+    double const batch_secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - b0).count();
+
+    // GameImpl: the same deals, one game at a time
+    std::vector<PlyrIdxT> scalar_losers(games);
+    uint64_t scalar_plies = 0;
+    GameImpl g(base, std::make_unique<ClassicRules>());
+    auto const s0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < games; ++i)
+    {
+        g.Restore(deals[i]);
+        MoveOutcome out = MoveOutcome::Applied;
+        for (uint32_t step = 0; step < MaxSteps && out != MoveOutcome::GameEnded; ++step)
+        {
+            out = g.Resolve(GreedyAction(g));
+            ++scalar_plies;
+        }
+        scalar_losers[i] = LoserOf(g);
+    }
+    double const scalar_secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - s0).count();
+
+    size_t disagree = 0;
+    size_t cut_off = 0;
+    for (size_t i = 0; i < games; ++i)
+    {
+        disagree += batch_losers[i] != scalar_losers[i];
+        cut_off += batch_losers[i] == BatchSim::NoSeat;
+    }
+
+    std::print("  BatchSim: {:.3f} s  {:.0f} games/s  {:.0f} plies/s\n",
+               batch_secs, games / batch_secs, batch_plies / batch_secs);
+    std::print("  GameImpl: {:.3f} s  {:.0f} games/s  {:.0f} plies/s\n",
+               scalar_secs, games / scalar_secs, scalar_plies / scalar_secs);
+    std::print("  speedup x{:.1f}, losers disagree in {} of {} games ({} drawn or cut off)\n",
+               scalar_secs / batch_secs, disagree, games, cut_off);
+    return disagree == 0 ? 0 : 1;
+}
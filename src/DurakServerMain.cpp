@@ -3,33 +3,35 @@
 // Allman style. Explicit types. No K&R.
 //
 // A minimal authoritative server using WebSocket++ (no TLS) + standalone Asio.
-// Waits for N seats to connect, then runs the game to completion.
-// Each seat is driven by a blocking remote Player that receives snapshots and
-// must respond with a PlayerAction message (or times out -> Pass/Take fallback).
+// Hosts T tables of N seats on the network event loop. Connections fill tables in order and
+// a table starts once its seats are taken. Actions arrive as PlayerAction messages and are fed to
+// that table's TableHost; all decision deadlines share one TimerWheel, advanced by a loop timer
+// that runs only while deadlines are pending (timeout -> default action).
+// Every state change goes to all seats as one SnapshotMsg each; the seat that must act next
+// additionally gets a DecisionRequest carrying its deadline.
 
 #include <cstdint>
-#include <deque>
-#include <mutex>
 #include <map>
-#include <condition_variable>
-#include <thread>
-#include <unordered_map>
-#include <atomic>
 #include <cstdio>
 #include <print>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <optional>
 #include <chrono>
+#include <functional>
+#include <memory>
 
 #include <websocketpp/config/asio_no_tls.hpp>
 #include <websocketpp/server.hpp>
 
 #include "core/Game.hpp"
 #include "core/ClassicRules.hpp"
-#include "core/RandomAi.hpp"   // not used by server-side seats, here for config parity/logs
+#include "core/CounterRng.hpp"
 #include "core/Exception.hpp"
-#include "net/codec.hpp"       // BuildSnapshot, BuildAction_*, DecodePlayerAction
+#include "core/TableHost.hpp"
+#include "core/TimerWheel.hpp"
+#include "net/codec.hpp"       // BuildSnapshot, BuildDecisionRequest, BuildViolation, DecodePlayerAction
 
 // Generated FB headers are available via include path set in CMake.
 #include "generated/flatbuffers/durak_net_generated.h"
@@ -38,172 +40,39 @@ namespace
 {
     using WsServer = websocketpp::server<websocketpp::config::asio>;
 
-    struct Frame
-    {
-        std::vector<std::uint8_t> bytes;
-    };
+    // How often the loop advances the timer wheel (deadline resolution).
+    constexpr long TickMs = 10;
 
-    class InboundQueue
+    struct SeatConn
     {
-    public:
-        InboundQueue() = default;
-
-        void push(Frame f)
-        {
-            std::lock_guard<std::mutex> lock(m_);
-            q_.push_back(std::move(f));
-            cv_.notify_one();
-        }
-
-        // Pop a frame until absolute deadline; returns false on timeout.
-        bool pop_until(std::chrono::steady_clock::time_point deadline, Frame& out)
-        {
-            std::unique_lock<std::mutex> lock(m_);
-            while (q_.empty())
-            {
-                if (cv_.wait_until(lock, deadline) == std::cv_status::timeout)
-                {
-                    return false;
-                }
-            }
-            out = std::move(q_.front());
-            q_.pop_front();
-            return true;
-        }
-
-        // Non-blocking pop (for drains / close)
-        bool try_pop(Frame& out)
-        {
-            std::lock_guard<std::mutex> lock(m_);
-            if (q_.empty())
-            {
-                return false;
-            }
-            out = std::move(q_.front());
-            q_.pop_front();
-            return true;
-        }
-
-    private:
-        std::mutex m_;
-        std::condition_variable cv_;
-        std::deque<Frame> q_;
+        durak::core::PlyrIdxT seat{0};
+        websocketpp::connection_hdl hdl{};
+        bool connected{false};
     };
 
-    // A server-side Player adapter bound to a seat and a socket send function.
-    // It blocks inside Play() waiting for a PlayerAction frame from the network.
-    class WsRemotePlayer final : public durak::core::Player
+    struct Table
     {
-    public:
-        using SendFn = std::function<void(const std::uint8_t *, std::size_t)>;
-
-        WsRemotePlayer(durak::core::PlyrIdxT seat,
-                       std::shared_ptr<InboundQueue> inbox,
-                       SendFn send)
-            : seat_(seat)
-              , inbox_(std::move(inbox))
-              , send_(std::move(send))
-              , next_msg_id_(1ULL)
-        {
-        }
-
-        durak::core::PlayerAction Play(std::shared_ptr<const durak::core::GameSnapshot> snapshot,
-                                       std::chrono::steady_clock::time_point deadline) override
-        {
-            // 1) Push a fresh snapshot to this seat (so their UI/AI is up to date)
-            flatbuffers::DetachedBuffer buf =
-                durak::core::net::BuildSnapshot(*snapshot_owner_, seat_, next_msg_id_++);
-
-            const std::uint8_t* data_ptr = buf.data();
-            const std::size_t data_len = buf.size();
-
-            send_(data_ptr, data_len);
-
-            // 2) Wait for a PlayerActionMsg until deadline; on timeout -> Pass/Take fallback.
-            Frame f{};
-            bool got = inbox_->pop_until(deadline, f);
-            if (!got)
-            {
-                // Use snapshot phase to choose fallback.
-                if (snapshot->phase == durak::core::Phase::Defending)
-                {
-                    std::print("[Seat {}] Play timeout -> Take\n", static_cast<int>(seat_));
-                    return durak::core::TakeAction{};
-                }
-                else
-                {
-                    std::print("[Seat {}] Play timeout -> Pass\n", static_cast<int>(seat_));
-                    return durak::core::PassAction{};
-                }
-            }
-
-            // 3) Decode and validate envelope locally (parsing only; rules are on Game side)
-            std::span<const std::byte> bytes{
-                reinterpret_cast<const std::byte*>(f.bytes.data()),
-                f.bytes.size()
-            };
-
-            std::expected<durak::core::net::DecodedAction, durak::core::net::ParseError> parsed =
-                durak::core::net::DecodePlayerAction(*game_, bytes);
-
-            if (!parsed.has_value())
-            {
-                std::print("[Seat {}] Parse error: {}\n", static_cast<int>(seat_), parsed.error().message);
-                // Keep waiting until deadline exhausted? Simple approach: fall back now.
-                if (snapshot->phase == durak::core::Phase::Defending)
-                {
-                    return durak::core::TakeAction{};
-                }
-                return durak::core::PassAction{};
-            }
-
-            // 4) Anti-spoof: actor in message must match seat bound to this connection.
-            if (parsed->actor != seat_)
-            {
-                std::print("[Seat {}] Spoofed actor {} -> rejected\n",
-                           static_cast<int>(seat_), static_cast<int>(parsed->actor));
-                if (snapshot->phase == durak::core::Phase::Defending)
-                {
-                    return durak::core::TakeAction{};
-                }
-                return durak::core::PassAction{};
-            }
-
-            return parsed->action;
-        }
-
-        // Bound by server right after creating GameImpl (so BuildSnapshot can use it)
-        void BindGameAndSnapshotOwner(durak::core::GameImpl* game, const durak::core::GameImpl* snapshot_owner)
-        {
-            game_ = game;
-            snapshot_owner_ = snapshot_owner;
-        }
-
-    private:
-        durak::core::PlyrIdxT seat_;
-        std::shared_ptr<InboundQueue> inbox_;
-        SendFn send_;
-        std::uint64_t next_msg_id_;
-
-        // Pointers valid for the lifetime of the match
-        durak::core::GameImpl* game_{nullptr};
-        const durak::core::GameImpl* snapshot_owner_{nullptr};
+        std::vector<SeatConn> seats;
+        std::uint8_t connected{0};
+        std::unique_ptr<durak::core::TableHost> host;
+        std::uint64_t step_no{0};
+        // Outstanding decision, re-sent to its seat on reconnect
+        std::optional<std::uint8_t> decision_seat;
+        durak::core::TimerWheel::Clock::time_point decision_deadline{};
     };
 
-    struct SeatConn
+    struct SeatRef
     {
-        durak::core::PlyrIdxT seat{0};
-        websocketpp::connection_hdl hdl{};
-        std::shared_ptr<InboundQueue> inbox;
-        std::shared_ptr<WsRemotePlayer> player;
-        bool connected{false};
+        std::size_t table{0};
+        std::uint8_t seat{0};
     };
 
     struct CmdLine
     {
         std::uint16_t port{9002};
         std::uint8_t players{2};
-        std::uint64_t seed{12345ULL};
+        std::uint32_t tables{1};
+        std::uint64_t seed{12345ULL}; // table t deals with CounterRng::SeedFor(seed, t, DeckStream)
         bool deck36{true};
         std::uint8_t deal_up_to{6};
         std::uint32_t turn_timeout_ms{15000};
@@ -246,6 +115,7 @@ namespace
 
             if (key == "--port") { read_u16(c.port); }
             else if (key == "--players") { read_u8(c.players); }
+            else if (key == "--tables") { read_u32(c.tables); }
             else if (key == "--seed") { read_u64(c.seed); }
             else if (key == "--deal-up-to") { read_u8(c.deal_up_to); }
             else if (key == "--turn-timeout-ms") { read_u32(c.turn_timeout_ms); }
@@ -262,6 +132,10 @@ namespace
         {
             c.players = 2;
         }
+        if (c.tables < 1)
+        {
+            c.tables = 1;
+        }
         return c;
     }
 } // anon
@@ -270,8 +144,8 @@ int main(int argc, char** argv)
 {
     CmdLine cfg = parse_args(argc, argv);
 
-    std::print("[Server] Booting on port {} | waiting for {} player(s)\n",
-               cfg.port, static_cast<int>(cfg.players));
+    std::print("[Server] Booting on port {} | {} table(s) of {} player(s)\n",
+               cfg.port, cfg.tables, static_cast<int>(cfg.players));
 
     WsServer server;
     server.clear_access_channels(websocketpp::log::alevel::all);
@@ -279,261 +153,298 @@ int main(int argc, char** argv)
         websocketpp::log::alevel::disconnect);
     server.init_asio();
 
-    std::mutex seats_mx;
-    std::condition_variable seats_cv;
-    std::vector<std::shared_ptr<SeatConn>> seats;
-    seats.reserve(cfg.players);
-    for (std::uint8_t i = 0; i < cfg.players; ++i)
+    // Everything below runs on the one thread inside server.run(), so no locking.
+    std::vector<std::unique_ptr<Table>> tables;
+    for (std::uint32_t t = 0; t < cfg.tables; ++t)
     {
-        std::shared_ptr<SeatConn> sc = std::make_shared<SeatConn>();
-        sc->seat = i;
-        sc->inbox = std::make_shared<InboundQueue>();
-        seats.push_back(std::move(sc));
+        auto tb = std::make_unique<Table>();
+        tb->seats.resize(cfg.players);
+        for (std::uint8_t i = 0; i < cfg.players; ++i)
+        {
+            tb->seats[i].seat = i;
+        }
+        tables.push_back(std::move(tb));
     }
-
-    std::atomic<std::uint8_t> connected_count{0};
+    std::uint32_t tables_done = 0;
 
     using Hdl = websocketpp::connection_hdl;
-    // Map hdl -> seat index
-    std::mutex map_mx;
-    std::map<Hdl, uint8_t, std::owner_less<Hdl>> hdl_to_seat;
+    std::map<Hdl, SeatRef, std::owner_less<Hdl>> hdl_to_seat;
 
-    server.set_open_handler([&](websocketpp::connection_hdl hdl)
+    durak::core::TimerWheel wheel(durak::core::TimerWheel::Clock::now(), std::chrono::milliseconds(TickMs));
+    bool ticking = false;
+    std::uint64_t next_msg_id = 1000;
+
+    // Helper: send one prepared frame to a single seat
+    auto send_to = [&](Table& tb, std::uint8_t s, flatbuffers::DetachedBuffer const& buf)
     {
-        std::lock_guard<std::mutex> lock(seats_mx);
-        if (connected_count.load() >= cfg.players)
+        if (!tb.seats[s].connected)
         {
-            std::print("[Server] Extra connection rejected (seats full)\n");
-            try
-            {
-                server.close(hdl, websocketpp::close::status::policy_violation, "Seats full");
-            }
-            catch (...)
-            {
-            }
             return;
         }
-
-        std::uint8_t seat = connected_count.load();
-        seats[seat]->hdl = hdl;
-        seats[seat]->connected = true;
-        ++connected_count;
-
+        try
         {
-            std::lock_guard<std::mutex> g(map_mx);
-            hdl_to_seat[hdl] = seat;
+            server.send(tb.seats[s].hdl, buf.data(), buf.size(), websocketpp::frame::opcode::binary);
         }
+        catch (const std::exception& e)
+        {
+            std::print("[Server] send() error seat {}: {}\n", static_cast<int>(s), e.what());
+        }
+        catch (...)
+        {
+        }
+    };
 
-        std::print("[Server] Seat {} connected ({} of {})\n",
-                   static_cast<int>(seat),
-                   static_cast<int>(connected_count.load()),
-                   static_cast<int>(cfg.players));
-
-        seats_cv.notify_all();
-    });
-
-    server.set_close_handler([&](websocketpp::connection_hdl hdl)
+    // Helper: broadcast a snapshot to every seat of a table
+    auto broadcast_snapshot = [&](Table& tb)
     {
-        std::optional<std::uint8_t> seat_opt;
+        for (std::uint8_t s = 0; s < cfg.players; ++s)
         {
-            std::lock_guard<std::mutex> g(map_mx);
-            auto it = hdl_to_seat.find(hdl);
-            if (it != hdl_to_seat.end())
-            {
-                seat_opt = it->second;
-                hdl_to_seat.erase(it);
-            }
+            send_to(tb, s, durak::core::net::BuildSnapshot(tb.host->Game(), s, next_msg_id++));
         }
-        if (seat_opt.has_value())
+    };
+
+    auto shutdown = [&]()
+    {
+        try
         {
-            std::lock_guard<std::mutex> lock(seats_mx);
-            std::uint8_t seat = *seat_opt;
-            if (seats[seat]->connected)
+            server.stop_listening();
+            // Close all connections politely
+            for (std::unique_ptr<Table> const& tb : tables)
             {
-                seats[seat]->connected = false;
-                if (connected_count.load() > 0)
+                for (SeatConn const& sc : tb->seats)
                 {
-                    connected_count--;
+                    if (!sc.connected)
+                    {
+                        continue;
+                    }
+                    try
+                    {
+                        server.close(sc.hdl, websocketpp::close::status::going_away, "Game over");
+                    }
+                    catch (...)
+                    {
+                    }
                 }
-                std::print("[Server] Seat {} disconnected\n", static_cast<int>(seat));
-                seats_cv.notify_all();
             }
         }
-    });
+        catch (...)
+        {
+        }
+    };
 
-    server.set_message_handler([&](websocketpp::connection_hdl hdl, WsServer::message_ptr msg)
+    // Advances the wheel while anything is pending; an idle server schedules nothing.
+    std::function<void(websocketpp::lib::error_code const&)> tick = [&](websocketpp::lib::error_code const& ec)
     {
-        // Only binary frames are valid
-        if (msg->get_opcode() != websocketpp::frame::opcode::binary)
+        if (ec)
         {
-            std::print("[Server] Ignoring non-binary frame from client\n");
+            ticking = false;
             return;
         }
-
-        std::uint8_t seat = 0xFF;
+        wheel.Advance(durak::core::TimerWheel::Clock::now());
+        ticking = wheel.Pending() != 0;
+        if (ticking)
         {
-            std::lock_guard<std::mutex> g(map_mx);
-            auto it = hdl_to_seat.find(hdl);
-            if (it == hdl_to_seat.end())
-            {
-                return;
-            }
-            seat = it->second;
+            server.set_timer(TickMs, tick);
         }
-
-        std::string const& payload = msg->get_payload();
-        Frame f{};
-        f.bytes.assign(reinterpret_cast<const std::uint8_t*>(payload.data()),
-                       reinterpret_cast<const std::uint8_t*>(payload.data()) + payload.size());
-
-        seats[seat]->inbox->push(std::move(f));
-    });
-
-    // Start network
-    server.listen(cfg.port);
-    server.start_accept();
-    std::thread net_thr([&server]()
+    };
+    auto ensure_tick = [&]()
     {
-        server.run();
-    });
+        if (!ticking && wheel.Pending() != 0)
+        {
+            ticking = true;
+            server.set_timer(TickMs, tick);
+        }
+    };
 
-    // Wait until all seats are connected
+    auto make_hooks = [&](Table& table, std::size_t t) -> durak::core::TableHost::Hooks
     {
-        std::unique_lock<std::mutex> lk(seats_mx);
-        seats_cv.wait(lk, [&]()
+        durak::core::TableHost::Hooks hooks{};
+        hooks.on_step = [&, &tb = table, t](durak::core::MoveOutcome out)
         {
-            return connected_count.load() >= cfg.players;
-        });
-    }
-
-    std::print("[Server] All players connected. Starting match…\n");
+            tb.step_no++;
+            tb.decision_seat.reset();
+            std::print("[Server] Table {} step {} -> outcome {}\n", t, tb.step_no, static_cast<int>(out));
 
-    // Build players (all network seats)
-    std::vector<std::unique_ptr<durak::core::Player>> players;
-    players.reserve(cfg.players);
+            broadcast_snapshot(tb);
 
-    // Helper to send binary to a seat
-    auto make_send_fn = [&](std::uint8_t seat) -> WsRemotePlayer::SendFn
-    {
-        return [seat, &server, &seats](const std::uint8_t* data, std::size_t len)
-        {
-            websocketpp::connection_hdl hdl = seats[seat]->hdl;
-            try
-            {
-                server.send(hdl, data, len, websocketpp::frame::opcode::binary);
-            }
-            catch (const std::exception& e)
-            {
-                std::print("[Server] send() error seat {}: {}\n", static_cast<int>(seat), e.what());
-            }
-            catch (...)
+            if (out == durak::core::MoveOutcome::GameEnded)
             {
+                std::print("[Server] Table {} ended after {} steps ({} timeouts).\n",
+                           t, tb.step_no, tb.host->Timeouts());
+                if (++tables_done == tables.size())
+                {
+                    // Keep server up a moment to flush frames
+                    server.set_timer(250, [&](websocketpp::lib::error_code const&)
+                    {
+                        shutdown();
+                    });
+                }
             }
         };
+        // Rejected action: tell the offending seat only. A retry is asked for with a DecisionRequest
+        // carrying the unchanged deadline; the state did not change, so no snapshot goes out.
+        hooks.on_violation = [&, &tb = table](durak::core::PlyrIdxT seat, durak::core::error::RuleViolation const& v)
+        {
+            send_to(tb, seat, durak::core::net::BuildViolation(v, next_msg_id++));
+        };
+        hooks.on_decision = [&, &tb = table](durak::core::PlyrIdxT seat,
+                                             durak::core::TimerWheel::Clock::time_point deadline)
+        {
+            tb.decision_seat = seat;
+            tb.decision_deadline = deadline;
+            send_to(tb, seat, durak::core::net::BuildDecisionRequest(seat, deadline, next_msg_id++));
+            ensure_tick();
+        };
+        hooks.on_violation_summary = [t](std::string_view const line)
+        {
+            std::print("[Server] Table {} {}\n", t, line);
+        };
+        return hooks;
     };
 
-    for (std::uint8_t s = 0; s < cfg.players; ++s)
+    auto start_table = [&](std::size_t t)
     {
-        std::shared_ptr<WsRemotePlayer> rp = std::make_shared<WsRemotePlayer>(
-            s,
-            seats[s]->inbox,
-            make_send_fn(s)
-        );
-        seats[s]->player = rp;
-        players.push_back(std::unique_ptr<durak::core::Player>(rp.get()));
-        // NOTE: we will keep shared_ptr alive via seats[s]->player.
-        // The unique_ptr in players does NOT own, but points to the same object.
-        // To keep ownership clear, allocate raw and wrap both? For simplicity,
-        // allocate once and release unique_ptr before leaving.
-    }
-
-    // Build GameImpl
-    durak::core::Config gcfg{};
-    gcfg.n_players = cfg.players;
-    gcfg.deal_up_to = cfg.deal_up_to;
-    gcfg.deck36 = cfg.deck36;
-    gcfg.seed = cfg.seed;
-    gcfg.turn_timeout = std::chrono::milliseconds(cfg.turn_timeout_ms);
-
-    std::unique_ptr<durak::core::Rules> rules = std::make_unique<durak::core::ClassicRules>();
-    durak::core::GameImpl game(gcfg, std::move(rules), std::move(players));
+        std::print("[Server] Table {} full. Starting match…\n", t);
+        Table& tb = *tables[t];
+
+        durak::core::Config gcfg{};
+        gcfg.n_players = cfg.players;
+        gcfg.deal_up_to = cfg.deal_up_to;
+        gcfg.deck36 = cfg.deck36;
+        gcfg.seed = durak::core::CounterRng::SeedFor(cfg.seed, t, durak::core::CounterRng::DeckStream);
+        gcfg.turn_timeout = std::chrono::milliseconds(cfg.turn_timeout_ms);
+
+        tb.host = std::make_unique<durak::core::TableHost>(gcfg, durak::core::MakeClassicRules(gcfg), wheel,
+                                                           make_hooks(tb, t));
+
+        // Initial broadcast so clients can render something immediately
+        broadcast_snapshot(tb);
+        tb.host->Start(durak::core::TimerWheel::Clock::now());
+    };
 
-    // Bind snapshot/game pointers for snapshot-sending in WsRemotePlayer
-    for (std::uint8_t s = 0; s < cfg.players; ++s)
+    server.set_open_handler([&](websocketpp::connection_hdl hdl)
     {
-        if (seats[s]->player)
+        // First free seat of the first table still open; a seat dropped mid-match can be taken back
+        // (its deadlines kept running meanwhile)
+        for (std::size_t t = 0; t < tables.size(); ++t)
         {
-            seats[s]->player->BindGameAndSnapshotOwner(&game, &game);
-        }
-    }
+            Table& tb = *tables[t];
+            if (tb.connected >= cfg.players || (tb.host && tb.host->Finished()))
+            {
+                continue;
+            }
 
-    // Helper: broadcast a snapshot to every seat
-    auto broadcast_snapshot = [&](std::uint64_t msg_id_base)
-    {
-        for (std::uint8_t s = 0; s < cfg.players; ++s)
-        {
-            std::shared_ptr<const durak::core::GameSnapshot> snap = game.SnapshotFor(s);
-            flatbuffers::DetachedBuffer buf =
-                durak::core::net::BuildSnapshot(game, s, msg_id_base + s);
+            std::uint8_t seat = 0;
+            while (tb.seats[seat].connected)
+            {
+                ++seat;
+            }
+            tb.seats[seat].hdl = hdl;
+            tb.seats[seat].connected = true;
+            ++tb.connected;
+            hdl_to_seat[hdl] = SeatRef{t, seat};
+
+            std::print("[Server] Table {} seat {} connected ({} of {})\n",
+                       t, static_cast<int>(seat), static_cast<int>(tb.connected), static_cast<int>(cfg.players));
 
-            try
+            if (tb.host)
             {
-                server.send(seats[s]->hdl, buf.data(), buf.size(), websocketpp::frame::opcode::binary);
+                send_to(tb, seat, durak::core::net::BuildSnapshot(tb.host->Game(), seat, next_msg_id++));
+                if (tb.decision_seat == seat)
+                {
+                    send_to(tb, seat, durak::core::net::BuildDecisionRequest(seat, tb.decision_deadline,
+                                                                             next_msg_id++));
+                }
             }
-            catch (...)
+            else if (tb.connected == cfg.players)
             {
+                start_table(t);
             }
+            return;
         }
-    };
 
-    // Initial broadcast so clients can render something immediately
-    broadcast_snapshot(/*msg_id_base*/1000);
+        std::print("[Server] Extra connection rejected (seats full)\n");
+        try
+        {
+            server.close(hdl, websocketpp::close::status::policy_violation, "Seats full");
+        }
+        catch (...)
+        {
+        }
+    });
+
+    server.set_close_handler([&](websocketpp::connection_hdl hdl)
+    {
+        auto it = hdl_to_seat.find(hdl);
+        if (it == hdl_to_seat.end())
+        {
+            return;
+        }
+        SeatRef const ref = it->second;
+        hdl_to_seat.erase(it);
+        Table& tb = *tables[ref.table];
+        if (tb.seats[ref.seat].connected)
+        {
+            tb.seats[ref.seat].connected = false;
+            tb.connected--;
+            std::print("[Server] Table {} seat {} disconnected\n", ref.table, static_cast<int>(ref.seat));
+        }
+    });
 
-    // Main loop
-    std::uint64_t step_no = 0;
-    while (true)
+    server.set_message_handler([&](websocketpp::connection_hdl hdl, WsServer::message_ptr msg)
     {
-        durak::core::MoveOutcome out = game.Step();
-        step_no++;
+        // Only binary frames are valid
+        if (msg->get_opcode() != websocketpp::frame::opcode::binary)
+        {
+            std::print("[Server] Ignoring non-binary frame from client\n");
+            return;
+        }
 
-        std::print("[Server] Step {} -> outcome {}\n",
-                   step_no, static_cast<int>(out));
+        auto it = hdl_to_seat.find(hdl);
+        if (it == hdl_to_seat.end())
+        {
+            return;
+        }
+        Table& tb = *tables[it->second.table];
+        std::uint8_t const seat = it->second.seat;
+        if (!tb.host || tb.host->Finished())
+        {
+            return;
+        }
 
-        broadcast_snapshot(/*msg_id_base*/2000 + step_no * 10);
+        std::string const& payload = msg->get_payload();
+        std::span<const std::byte> bytes{
+            reinterpret_cast<const std::byte*>(payload.data()),
+            payload.size()
+        };
 
-        if (out == durak::core::MoveOutcome::GameEnded)
+        // Parsing only; rules are on the Game side. A bad frame is dropped and the deadline keeps running.
+        std::expected<durak::core::net::DecodedAction, durak::core::net::ParseError> parsed =
+            durak::core::net::DecodePlayerAction(tb.host->Game(), bytes);
+        if (!parsed.has_value())
         {
-            std::print("[Server] Match ended after {} steps.\n", step_no);
-            break;
+            std::print("[Seat {}] Parse error: {}\n", static_cast<int>(seat), parsed.error().message);
+            return;
         }
-    }
 
-    // Keep server up a moment to flush frames
-    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        // Anti-spoof: actor in message must match seat bound to this connection.
+        if (parsed->actor != seat)
+        {
+            std::print("[Seat {}] Spoofed actor {} -> rejected\n",
+                       static_cast<int>(seat), static_cast<int>(parsed->actor));
+            return;
+        }
 
-    try
-    {
-        server.stop_listening();
-        // Close all connections politely
-        for (std::uint8_t s = 0; s < cfg.players; ++s)
+        if (!tb.host->Submit(seat, parsed->action, durak::core::TimerWheel::Clock::now()))
         {
-            try
-            {
-                server.close(seats[s]->hdl, websocketpp::close::status::going_away, "Game over");
-            }
-            catch (...)
-            {
-            }
+            std::print("[Seat {}] Out-of-turn action ignored\n", static_cast<int>(seat));
         }
-    }
-    catch (...)
-    {
-    }
+    });
 
-    if (net_thr.joinable())
-    {
-        net_thr.join();
-    }
+    // Start network; returns once every match is over and every connection closed
+    server.listen(cfg.port);
+    server.start_accept();
+    server.run();
 
     return 0;
 }
\ No newline at end of file
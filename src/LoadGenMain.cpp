@@ -0,0 +1,344 @@
+// File: src/LoadGenMain.cpp
+//
+// Allman braces. Explicit types.
+//
+// Load generator: one process opens thousands of WebSocket seats against a server,
+// spread over a small pool of io_contexts (one WsClient endpoint per pool thread).
+// Every seat owns its own BotSeat (RandomAI + latest view). Supports think-time
+// distributions, connection ramp-up and live throughput / error-rate reporting.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <print>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <websocketpp/config/asio_no_tls_client.hpp>
+#include <websocketpp/client.hpp>
+
+#include "net/BotSeat.hpp"
+
+namespace
+{
+    using WsClient = websocketpp::client<websocketpp::config::asio_client>;
+    using Hdl = websocketpp::connection_hdl;
+    using Clock = std::chrono::steady_clock;
+
+    enum class ThinkKind : std::uint8_t
+    {
+        None,
+        Fixed,
+        Uniform,
+        Exponential
+    };
+
+    struct CmdLine
+    {
+        std::string url{"ws://127.0.0.1:9002"};
+        std::uint32_t seats{1000};
+        std::uint32_t io_threads{4};
+        std::uint32_t ramp_per_sec{500}; // 0 = connect everything at once
+        ThinkKind think{ThinkKind::None};
+        std::uint32_t think_ms{50}; // fixed value, uniform lower bound or exponential mean
+        std::uint32_t think_max_ms{250}; // uniform upper bound
+        std::uint32_t report_ms{1000}; // at least 1
+        std::uint32_t duration_s{0}; // 0 = until every seat is closed
+        std::uint64_t seed{424242ULL};
+    };
+
+    CmdLine parse_args(int argc, char** argv)
+    {
+        CmdLine c{};
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string k = argv[i];
+            auto read_u64 = [&]() -> std::uint64_t
+            {
+                return (i + 1 < argc) ? std::strtoull(argv[++i], nullptr, 10) : 0ULL;
+            };
+
+            if (k == "--url" && i + 1 < argc) { c.url = argv[++i]; }
+            else if (k == "--seats") { c.seats = static_cast<std::uint32_t>(read_u64()); }
+            else if (k == "--io-threads") { c.io_threads = static_cast<std::uint32_t>(read_u64()); }
+            else if (k == "--ramp-per-sec") { c.ramp_per_sec = static_cast<std::uint32_t>(read_u64()); }
+            else if (k == "--think-ms") { c.think_ms = static_cast<std::uint32_t>(read_u64()); }
+            else if (k == "--think-max-ms") { c.think_max_ms = static_cast<std::uint32_t>(read_u64()); }
+            else if (k == "--report-ms") { c.report_ms = static_cast<std::uint32_t>(read_u64()); }
+            else if (k == "--duration-s") { c.duration_s = static_cast<std::uint32_t>(read_u64()); }
+            else if (k == "--seed") { c.seed = read_u64(); }
+            else if (k == "--think" && i + 1 < argc)
+            {
+                std::string const v = argv[++i];
+                if (v == "fixed") { c.think = ThinkKind::Fixed; }
+                else if (v == "uniform") { c.think = ThinkKind::Uniform; }
+                else if (v == "exp") { c.think = ThinkKind::Exponential; }
+                else { c.think = ThinkKind::None; }
+            }
+        }
+        c.io_threads = std::max<std::uint32_t>(c.io_threads, 1);
+        c.report_ms = std::max<std::uint32_t>(c.report_ms, 1); // the reporter divides by the interval
+        c.think_max_ms = std::max(c.think_max_ms, c.think_ms);
+        return c;
+    }
+
+    struct LoadStats
+    {
+        std::atomic<std::uint32_t> open{0};
+        std::atomic<std::uint32_t> connect_failed{0};
+        std::atomic<std::uint32_t> closed{0};
+        std::atomic<std::uint64_t> frames_rx{0};
+        std::atomic<std::uint64_t> bytes_rx{0};
+        std::atomic<std::uint64_t> actions_tx{0};
+        std::atomic<std::uint64_t> bytes_tx{0};
+        std::atomic<std::uint64_t> errors{0}; // send failures + unbuildable actions
+    };
+
+    struct LoadSeat
+    {
+        LoadSeat(std::uint64_t seed, WsClient& endpoint) :
+            bot(seed), think_rng(seed ^ 0xA5A5A5A5A5A5A5A5ULL), ep(&endpoint)
+        {
+        }
+
+        std::mutex mtx;
+        durak::net::BotSeat bot;
+        std::mt19937_64 think_rng;
+        WsClient* ep;
+        Hdl hdl{};
+        bool closed{false};
+    };
+
+    auto DrawThinkMs(CmdLine const& cl, std::mt19937_64& rng) -> long
+    {
+        switch (cl.think)
+        {
+        case ThinkKind::None: return 0;
+        case ThinkKind::Fixed: return static_cast<long>(cl.think_ms);
+        case ThinkKind::Uniform:
+            return static_cast<long>(std::uniform_int_distribution<std::uint32_t>{cl.think_ms, cl.think_max_ms}(rng));
+        case ThinkKind::Exponential:
+            if (cl.think_ms == 0) { return 0; }
+            return static_cast<long>(std::exponential_distribution<double>{1.0 / cl.think_ms}(rng));
+        }
+        return 0;
+    }
+
+    // Sends the reply right away, or after a think delay on the seat's own io_context.
+    auto SendReply(LoadSeat& seat, std::vector<std::uint8_t> bytes, long const delay_ms, LoadStats& stats) -> void
+    {
+        auto do_send = [&seat, &stats](std::vector<std::uint8_t> const& b)
+        {
+            std::lock_guard<std::mutex> lock(seat.mtx);
+            if (seat.closed)
+            {
+                return;
+            }
+            websocketpp::lib::error_code ec;
+            seat.ep->send(seat.hdl, b.data(), b.size(), websocketpp::frame::opcode::binary, ec);
+            if (ec)
+            {
+                stats.errors.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            stats.actions_tx.fetch_add(1, std::memory_order_relaxed);
+            stats.bytes_tx.fetch_add(b.size(), std::memory_order_relaxed);
+        };
+
+        if (delay_ms <= 0)
+        {
+            do_send(bytes);
+            return;
+        }
+
+        seat.ep->set_timer(delay_ms, [do_send, b = std::move(bytes)](websocketpp::lib::error_code const& ec)
+        {
+            if (!ec)
+            {
+                do_send(b);
+            }
+        });
+    }
+} // anon
+
+int main(int argc, char** argv)
+{
+    CmdLine const cl = parse_args(argc, argv);
+    std::print("[LoadGen] {} seats -> {} | io_threads={} ramp={}/s think_ms={}..{}\n",
+               cl.seats, cl.url, cl.io_threads, cl.ramp_per_sec, cl.think_ms, cl.think_max_ms);
+
+    // Small io_context pool: one endpoint (and io_context) per thread.
+    std::vector<std::unique_ptr<WsClient>> endpoints;
+    std::vector<std::thread> io_threads;
+    for (std::uint32_t i = 0; i < cl.io_threads; ++i)
+    {
+        auto ep = std::make_unique<WsClient>();
+        ep->clear_access_channels(websocketpp::log::alevel::all);
+        ep->clear_error_channels(websocketpp::log::elevel::all);
+        ep->init_asio();
+        ep->start_perpetual();
+        endpoints.push_back(std::move(ep));
+    }
+    for (auto const& ep : endpoints)
+    {
+        io_threads.emplace_back([e = ep.get()] { e->run(); });
+    }
+
+    LoadStats stats{};
+    std::atomic<bool> stop_reporting{false};
+    Clock::time_point const t0 = Clock::now();
+
+    std::thread reporter([&]()
+    {
+        std::uint64_t last_rx{0};
+        std::uint64_t last_tx{0};
+        std::uint64_t last_err{0};
+        Clock::time_point last = Clock::now();
+        while (!stop_reporting.load())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(cl.report_ms));
+            Clock::time_point const now = Clock::now();
+            double const dt = std::chrono::duration<double>(now - last).count();
+            last = now;
+
+            std::uint64_t const rx = stats.frames_rx.load();
+            std::uint64_t const tx = stats.actions_tx.load();
+            std::uint64_t const err = stats.errors.load();
+            std::uint64_t const d_tx = tx - last_tx;
+            std::uint64_t const d_err = err - last_err;
+
+            std::print("[LoadGen] t={:.1f}s open={} failed={} closed={} rx={:.0f}/s tx={:.0f}/s err={:.0f}/s ({:.2f}%)\n",
+                       std::chrono::duration<double>(now - t0).count(),
+                       stats.open.load(), stats.connect_failed.load(), stats.closed.load(),
+                       static_cast<double>(rx - last_rx) / dt,
+                       static_cast<double>(d_tx) / dt,
+                       static_cast<double>(d_err) / dt,
+                       (d_tx + d_err) ? 100.0 * static_cast<double>(d_err) / static_cast<double>(d_tx + d_err) : 0.0);
+
+            last_rx = rx;
+            last_tx = tx;
+            last_err = err;
+        }
+    });
+
+    std::vector<std::unique_ptr<LoadSeat>> seats;
+    seats.reserve(cl.seats);
+
+    auto const ramp_gap = cl.ramp_per_sec
+                              ? std::chrono::microseconds(1'000'000 / cl.ramp_per_sec)
+                              : std::chrono::microseconds(0);
+
+    for (std::uint32_t i = 0; i < cl.seats; ++i)
+    {
+        WsClient& ep = *endpoints[i % endpoints.size()];
+        seats.push_back(std::make_unique<LoadSeat>(cl.seed + i, ep));
+        LoadSeat* seat = seats.back().get();
+
+        websocketpp::lib::error_code ec;
+        WsClient::connection_ptr con = ep.get_connection(cl.url, ec);
+        if (ec)
+        {
+            stats.connect_failed.fetch_add(1);
+            continue;
+        }
+
+        con->set_open_handler([seat, &stats](Hdl hdl)
+        {
+            std::lock_guard<std::mutex> lock(seat->mtx);
+            seat->hdl = hdl;
+            stats.open.fetch_add(1);
+        });
+        con->set_fail_handler([seat, &stats](Hdl)
+        {
+            std::lock_guard<std::mutex> lock(seat->mtx);
+            seat->closed = true;
+            stats.connect_failed.fetch_add(1);
+        });
+        con->set_close_handler([seat, &stats](Hdl)
+        {
+            std::lock_guard<std::mutex> lock(seat->mtx);
+            seat->closed = true;
+            stats.closed.fetch_add(1);
+            stats.open.fetch_sub(1);
+        });
+        con->set_message_handler([seat, &stats, &cl](Hdl, WsClient::message_ptr msg)
+        {
+            std::string const& pl = msg->get_payload();
+            stats.frames_rx.fetch_add(1, std::memory_order_relaxed);
+            stats.bytes_rx.fetch_add(pl.size(), std::memory_order_relaxed);
+            if (msg->get_opcode() != websocketpp::frame::opcode::binary)
+            {
+                return;
+            }
+
+            durak::net::BotReply reply{};
+            long delay_ms{0};
+            {
+                std::lock_guard<std::mutex> lock(seat->mtx);
+                reply = seat->bot.OnFrame(
+                    std::span<std::uint8_t const>{reinterpret_cast<std::uint8_t const*>(pl.data()), pl.size()});
+                if (reply.verdict == durak::net::BotVerdict::BuildFailed)
+                {
+                    stats.errors.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                if (reply.verdict != durak::net::BotVerdict::Send)
+                {
+                    return;
+                }
+                delay_ms = DrawThinkMs(cl, seat->think_rng);
+            }
+            SendReply(*seat, std::move(reply.bytes), delay_ms, stats);
+        });
+
+        ep.connect(con);
+        if (ramp_gap.count() > 0)
+        {
+            std::this_thread::sleep_for(ramp_gap);
+        }
+    }
+
+    // Run for the requested duration, or until every seat has been closed by the server.
+    for (;;)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        bool const timed_out = cl.duration_s != 0 &&
+            Clock::now() - t0 >= std::chrono::seconds(cl.duration_s);
+        bool const all_gone = stats.closed.load() + stats.connect_failed.load() >= cl.seats;
+        if (timed_out || all_gone)
+        {
+            break;
+        }
+    }
+
+    for (auto const& seat : seats)
+    {
+        std::lock_guard<std::mutex> lock(seat->mtx);
+        if (!seat->closed)
+        {
+            websocketpp::lib::error_code ec;
+            seat->ep->close(seat->hdl, websocketpp::close::status::going_away, "LoadGen done", ec);
+        }
+    }
+    for (auto const& ep : endpoints)
+    {
+        ep->stop_perpetual();
+    }
+    for (std::thread& th : io_threads)
+    {
+        th.join();
+    }
+
+    stop_reporting = true;
+    reporter.join();
+
+    std::print("[LoadGen] done: actions={} frames={} errors={} connect_failed={}\n",
+               stats.actions_tx.load(), stats.frames_rx.load(), stats.errors.load(), stats.connect_failed.load());
+    return 0;
+}
@@ -0,0 +1,468 @@
+// File: src/LoopbackBenchMain.cpp
+//
+// Allman braces. Explicit types.
+//
+// End-to-end loopback macro benchmark. Hosts the authoritative server in-process
+// (RemotePlayer seats over WebSocket++ on a loopback port) and drives every seat
+// with a BotSeat client, the same decision logic NetAiClientMain uses. Plays a
+// fixed number of games and reports action round-trip percentiles, steps/sec,
+// bytes per step and CPU per game — the numbers we size production hosts with.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <print>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <websocketpp/config/asio_no_tls.hpp>
+#include <websocketpp/config/asio_no_tls_client.hpp>
+#include <websocketpp/server.hpp>
+#include <websocketpp/client.hpp>
+
+#include "core/Game.hpp"
+#include "core/ClassicRules.hpp"
+#include "core/Exception.hpp"
+#include "net/BotSeat.hpp"
+#include "net/RemotePlayer.hpp"
+#include "net/codec.hpp"
+
+namespace
+{
+    using WsServer = durak::net::WsServer;
+    using WsClient = websocketpp::client<websocketpp::config::asio_client>;
+    using Hdl = websocketpp::connection_hdl;
+    using Clock = std::chrono::steady_clock;
+
+    struct CmdLine
+    {
+        std::uint16_t port{9102};
+        std::uint32_t games{100};
+        std::uint32_t tables{8}; // games in flight at once
+        std::uint8_t players{2};
+        std::uint32_t client_threads{2};
+        std::uint32_t server_threads{1};
+        std::uint64_t seed{12345ULL};
+        std::uint32_t turn_timeout_ms{2000};
+    };
+
+    CmdLine parse_args(int argc, char** argv)
+    {
+        CmdLine c{};
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string key = argv[i];
+            auto read_u64 = [&]() -> std::uint64_t
+            {
+                return (i + 1 < argc) ? std::strtoull(argv[++i], nullptr, 10) : 0ULL;
+            };
+
+            if (key == "--port") { c.port = static_cast<std::uint16_t>(read_u64()); }
+            else if (key == "--games") { c.games = static_cast<std::uint32_t>(read_u64()); }
+            else if (key == "--tables") { c.tables = static_cast<std::uint32_t>(read_u64()); }
+            else if (key == "--players") { c.players = static_cast<std::uint8_t>(read_u64()); }
+            else if (key == "--client-threads") { c.client_threads = static_cast<std::uint32_t>(read_u64()); }
+            else if (key == "--server-threads") { c.server_threads = static_cast<std::uint32_t>(read_u64()); }
+            else if (key == "--seed") { c.seed = read_u64(); }
+            else if (key == "--turn-timeout-ms") { c.turn_timeout_ms = static_cast<std::uint32_t>(read_u64()); }
+        }
+        c.players = std::clamp<std::uint8_t>(c.players, 2, durak::core::constants::MaxPlayers);
+        c.tables = std::max<std::uint32_t>(c.tables, 1);
+        c.client_threads = std::max<std::uint32_t>(c.client_threads, 1);
+        c.server_threads = std::max<std::uint32_t>(c.server_threads, 1);
+        return c;
+    }
+
+    // Server side: one table is one GameImpl plus the channels of its seats.
+    struct BenchTable
+    {
+        std::vector<std::shared_ptr<durak::net::SeatChannel>> chans;
+        std::uint32_t connected{0};
+        std::uint64_t seed{};
+    };
+
+    struct SeatRef
+    {
+        std::size_t table{};
+        std::size_t seat{};
+    };
+
+    // Client side: one bot seat connection. Handlers may run on any client thread.
+    struct BotConn
+    {
+        explicit BotConn(std::uint64_t seed) :
+            bot(seed)
+        {
+        }
+
+        std::mutex mtx;
+        durak::net::BotSeat bot;
+        Clock::time_point sent_at{};
+        bool awaiting{false};
+        std::vector<std::uint32_t> rtt_us;
+        std::uint64_t tx_bytes{0};
+        std::uint64_t rx_bytes{0};
+    };
+
+    struct ServerStats
+    {
+        std::atomic<std::uint64_t> steps{0};
+        std::atomic<std::uint64_t> tx_bytes{0};
+        std::atomic<std::uint32_t> games_done{0};
+        std::atomic<std::uint32_t> games_failed{0};
+    };
+
+    auto Percentile(std::vector<std::uint32_t>& v, double const p) -> std::uint32_t
+    {
+        if (v.empty())
+        {
+            return 0;
+        }
+        std::size_t const k = std::min(v.size() - 1, static_cast<std::size_t>(p * static_cast<double>(v.size())));
+        std::ranges::nth_element(v, v.begin() + static_cast<std::ptrdiff_t>(k));
+        return v[k];
+    }
+
+    auto RunTable(BenchTable& table, CmdLine const& cl, ServerStats& stats) -> void
+    {
+        using namespace durak::core;
+
+        Config cfg{};
+        cfg.n_players = cl.players;
+        cfg.deal_up_to = 6;
+        cfg.deck36 = true;
+        cfg.seed = table.seed;
+        cfg.turn_timeout = std::chrono::milliseconds(cl.turn_timeout_ms);
+
+        std::vector<std::unique_ptr<Player>> players;
+        std::vector<durak::net::RemotePlayer*> remote_ptrs;
+        for (std::size_t s = 0; s < table.chans.size(); ++s)
+        {
+            auto rp = std::make_unique<durak::net::RemotePlayer>(static_cast<PlyrIdxT>(s), table.chans[s]);
+            remote_ptrs.push_back(rp.get());
+            players.emplace_back(std::move(rp));
+        }
+
+        GameImpl game(cfg, MakeClassicRules(cfg), std::move(players));
+        for (auto* rp : remote_ptrs)
+        {
+            rp->BindGame(game);
+        }
+
+        std::uint64_t msg_id{1};
+        auto broadcast = [&]()
+        {
+            for (PlyrIdxT seat = 0; seat < table.chans.size(); ++seat)
+            {
+                flatbuffers::DetachedBuffer const buf = net::BuildSnapshot(game, seat, msg_id);
+                std::span<std::byte const> bytes{reinterpret_cast<std::byte const*>(buf.data()), buf.size()};
+                if (table.chans[seat]->SendBinary(bytes))
+                {
+                    stats.tx_bytes.fetch_add(buf.size(), std::memory_order_relaxed);
+                }
+            }
+            ++msg_id;
+        };
+
+        broadcast();
+        MoveOutcome outcome = MoveOutcome::Applied;
+        while (outcome != MoveOutcome::GameEnded)
+        {
+            outcome = game.Step();
+            stats.steps.fetch_add(1, std::memory_order_relaxed);
+            broadcast();
+        }
+    }
+} // anon
+
+int main(int argc, char** argv)
+{
+    CmdLine const cl = parse_args(argc, argv);
+    std::string const url = "ws://127.0.0.1:" + std::to_string(cl.port);
+
+    std::print("[Bench] games={} tables={} players={} client_threads={} server_threads={} port={}\n",
+               cl.games, cl.tables, static_cast<int>(cl.players), cl.client_threads, cl.server_threads, cl.port);
+
+    // ---------------- Server ----------------
+    auto ep = std::make_shared<WsServer>();
+    ep->clear_access_channels(websocketpp::log::alevel::all);
+    ep->clear_error_channels(websocketpp::log::elevel::all);
+    ep->init_asio();
+    ep->set_reuse_addr(true);
+
+    std::mutex tables_mx;
+    std::condition_variable tables_cv;
+    std::vector<std::unique_ptr<BenchTable>> tables;
+    std::unordered_map<void*, SeatRef> hdl_to_seat;
+    ServerStats stats{};
+
+    ep->set_open_handler([&](Hdl hdl)
+    {
+        void* key = ep->get_con_from_hdl(hdl).get();
+        std::lock_guard<std::mutex> lock(tables_mx);
+        for (std::size_t t = 0; t < tables.size(); ++t)
+        {
+            BenchTable& tb = *tables[t];
+            if (tb.connected >= tb.chans.size())
+            {
+                continue;
+            }
+            std::size_t const seat = tb.connected++;
+            tb.chans[seat]->hdl = hdl;
+            tb.chans[seat]->connected = true;
+            hdl_to_seat[key] = SeatRef{t, seat};
+            tables_cv.notify_all();
+            return;
+        }
+        websocketpp::lib::error_code ec;
+        ep->close(hdl, websocketpp::close::status::try_again_later, "All seats occupied", ec);
+    });
+
+    ep->set_close_handler([&](Hdl hdl)
+    {
+        void* key = ep->get_con_from_hdl(hdl).get();
+        std::lock_guard<std::mutex> lock(tables_mx);
+        auto it = hdl_to_seat.find(key);
+        if (it == hdl_to_seat.end())
+        {
+            return;
+        }
+        if (it->second.table < tables.size())
+        {
+            tables[it->second.table]->chans[it->second.seat]->connected = false;
+        }
+        hdl_to_seat.erase(it);
+    });
+
+    ep->set_message_handler([&](Hdl hdl, WsServer::message_ptr msg)
+    {
+        if (msg->get_opcode() != websocketpp::frame::opcode::binary)
+        {
+            return;
+        }
+        void* key = ep->get_con_from_hdl(hdl).get();
+        std::shared_ptr<durak::net::SeatChannel> chan;
+        {
+            std::lock_guard<std::mutex> lock(tables_mx);
+            auto it = hdl_to_seat.find(key);
+            if (it == hdl_to_seat.end() || it->second.table >= tables.size())
+            {
+                return;
+            }
+            chan = tables[it->second.table]->chans[it->second.seat];
+        }
+        std::string const& payload = msg->get_payload();
+        chan->Enqueue(std::vector<std::uint8_t>(payload.begin(), payload.end()));
+    });
+
+    ep->listen(cl.port);
+    ep->start_accept();
+    std::vector<std::thread> server_threads;
+    for (std::uint32_t i = 0; i < cl.server_threads; ++i)
+    {
+        server_threads.emplace_back([ep] { ep->run(); });
+    }
+
+    // ---------------- Clients ----------------
+    WsClient client;
+    client.clear_access_channels(websocketpp::log::alevel::all);
+    client.clear_error_channels(websocketpp::log::elevel::all);
+    client.init_asio();
+    client.start_perpetual();
+
+    std::vector<std::thread> client_threads;
+    for (std::uint32_t i = 0; i < cl.client_threads; ++i)
+    {
+        client_threads.emplace_back([&client] { client.run(); });
+    }
+
+    std::vector<std::unique_ptr<BotConn>> conns;
+    conns.reserve(static_cast<std::size_t>(cl.games) * cl.players);
+
+    auto connect_bot = [&](BotConn* bc) -> bool
+    {
+        websocketpp::lib::error_code ec;
+        WsClient::connection_ptr con = client.get_connection(url, ec);
+        if (ec)
+        {
+            std::print("[Bench] get_connection error: {}\n", ec.message());
+            return false;
+        }
+
+        con->set_message_handler([&client, bc](Hdl hdl, WsClient::message_ptr msg)
+        {
+            if (msg->get_opcode() != websocketpp::frame::opcode::binary)
+            {
+                return;
+            }
+            std::string const& pl = msg->get_payload();
+            std::span<std::uint8_t const> frame{reinterpret_cast<std::uint8_t const*>(pl.data()), pl.size()};
+
+            std::lock_guard<std::mutex> lock(bc->mtx);
+            Clock::time_point const now = Clock::now();
+            bc->rx_bytes += pl.size();
+
+            // The game blocks on us after we act, so the next frame is the state our action produced.
+            if (bc->awaiting)
+            {
+                auto const rtt = std::chrono::duration_cast<std::chrono::microseconds>(now - bc->sent_at);
+                bc->rtt_us.push_back(static_cast<std::uint32_t>(rtt.count()));
+                bc->awaiting = false;
+            }
+
+            durak::net::BotReply const reply = bc->bot.OnFrame(frame);
+            if (reply.verdict != durak::net::BotVerdict::Send)
+            {
+                return;
+            }
+
+            websocketpp::lib::error_code send_ec;
+            client.send(hdl, reply.bytes.data(), reply.bytes.size(), websocketpp::frame::opcode::binary, send_ec);
+            if (!send_ec)
+            {
+                bc->tx_bytes += reply.bytes.size();
+                bc->sent_at = Clock::now();
+                bc->awaiting = true;
+            }
+        });
+
+        client.connect(con);
+        return true;
+    };
+
+    // ---------------- Batches ----------------
+    std::clock_t const cpu_start = std::clock();
+    Clock::time_point const wall_start = Clock::now();
+
+    std::uint32_t game_idx = 0;
+    while (game_idx < cl.games)
+    {
+        std::uint32_t const n = std::min(cl.tables, cl.games - game_idx);
+        {
+            std::lock_guard<std::mutex> lock(tables_mx);
+            tables.clear();
+            hdl_to_seat.clear();
+            for (std::uint32_t t = 0; t < n; ++t)
+            {
+                auto tb = std::make_unique<BenchTable>();
+                tb->seed = cl.seed + game_idx + t;
+                for (std::uint8_t s = 0; s < cl.players; ++s)
+                {
+                    auto ch = std::make_shared<durak::net::SeatChannel>();
+                    ch->ep = ep;
+                    tb->chans.push_back(std::move(ch));
+                }
+                tables.push_back(std::move(tb));
+            }
+        }
+
+        std::vector<std::thread> game_threads;
+        for (std::uint32_t t = 0; t < n; ++t)
+        {
+            game_threads.emplace_back([&, t]()
+            {
+                BenchTable* tb{};
+                {
+                    std::unique_lock<std::mutex> lk(tables_mx);
+                    tb = tables[t].get();
+                    bool const full = tables_cv.wait_for(lk, std::chrono::seconds(10), [&]
+                    {
+                        return tb->connected == tb->chans.size();
+                    });
+                    if (!full)
+                    {
+                        stats.games_failed.fetch_add(1);
+                        return;
+                    }
+                }
+
+                try
+                {
+                    RunTable(*tb, cl, stats);
+                    stats.games_done.fetch_add(1);
+                }
+                catch (durak::core::OmegaException<durak::core::error::Code> const& e)
+                {
+                    std::print("[Bench] table {} failed: {}\n", t, e.what());
+                    stats.games_failed.fetch_add(1);
+                }
+
+                for (auto const& ch : tb->chans)
+                {
+                    websocketpp::lib::error_code ec;
+                    ep->close(ch->hdl, websocketpp::close::status::going_away, "Game over", ec);
+                }
+            });
+        }
+
+        for (std::uint32_t i = 0; i < n * cl.players; ++i)
+        {
+            std::uint64_t const bot_seed = cl.seed ^ (0x9E3779B97F4A7C15ULL * (conns.size() + 1));
+            conns.push_back(std::make_unique<BotConn>(bot_seed));
+            connect_bot(conns.back().get());
+        }
+
+        for (std::thread& th : game_threads)
+        {
+            th.join();
+        }
+        game_idx += n;
+    }
+
+    Clock::time_point const wall_end = Clock::now();
+    std::clock_t const cpu_end = std::clock();
+
+    // ---------------- Shutdown ----------------
+    client.stop_perpetual();
+    for (std::thread& th : client_threads)
+    {
+        th.join();
+    }
+    ep->stop_listening();
+    ep->stop();
+    for (std::thread& th : server_threads)
+    {
+        th.join();
+    }
+
+    // ---------------- Report ----------------
+    std::vector<std::uint32_t> rtts;
+    std::uint64_t client_tx{0};
+    std::uint64_t client_rx{0};
+    for (auto const& bc : conns)
+    {
+        std::lock_guard<std::mutex> lock(bc->mtx);
+        rtts.insert(rtts.end(), bc->rtt_us.begin(), bc->rtt_us.end());
+        client_tx += bc->tx_bytes;
+        client_rx += bc->rx_bytes;
+    }
+
+    double const wall_s = std::chrono::duration<double>(wall_end - wall_start).count();
+    double const cpu_ms = 1000.0 * static_cast<double>(cpu_end - cpu_start) / CLOCKS_PER_SEC;
+    std::uint64_t const steps = stats.steps.load();
+    std::uint32_t const done = stats.games_done.load();
+    double const per_step = steps ? 1.0 / static_cast<double>(steps) : 0.0;
+
+    std::print("[Bench] games done={} failed={} steps={} wall={:.3f}s\n",
+               done, stats.games_failed.load(), steps, wall_s);
+    std::print("[Bench] action rtt us: p50={} p95={} p99={} (n={})\n",
+               Percentile(rtts, 0.50), Percentile(rtts, 0.95), Percentile(rtts, 0.99), rtts.size());
+    std::print("[Bench] steps/sec={:.1f}\n", wall_s > 0.0 ? static_cast<double>(steps) / wall_s : 0.0);
+    std::print("[Bench] bytes/step: server->clients={:.1f} clients->server={:.1f} (client rx total={})\n",
+               static_cast<double>(stats.tx_bytes.load()) * per_step,
+               static_cast<double>(client_tx) * per_step,
+               client_rx);
+    std::print("[Bench] cpu/game={:.2f} ms (whole process: server + clients)\n",
+               done ? cpu_ms / done : 0.0);
+
+    return stats.games_failed.load() == 0 ? 0 : 1;
+}
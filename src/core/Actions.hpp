@@ -5,14 +5,16 @@
 #ifndef IDIOTGAME_ACTIONS_HPP
 #define IDIOTGAME_ACTIONS_HPP
 
+#include "InlineVec.hpp"
 #include "Types.hpp"
 
 namespace durak::core
 {
     // player should remove and give the cards to the table so SP
+    // Bounded by the table, so the cards live inline and building an action never allocates.
     struct AttackAction
     {
-        std::vector<CardWP> cards;
+        InlineVec<CardWP, constants::MaxTableSlots> cards;
     };
 
     struct DefendPair
@@ -23,7 +25,7 @@ namespace durak::core
 
     struct DefendAction
     {
-        std::vector<DefendPair> pairs;
+        InlineVec<DefendPair, constants::MaxTableSlots> pairs;
     };
 
     struct TransferAction
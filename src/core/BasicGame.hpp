@@ -0,0 +1,89 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_BASICGAME_HPP
+#define IDIOTGAME_BASICGAME_HPP
+
+#include <concepts>
+#include <memory>
+#include <vector>
+
+#include "Game.hpp"
+#include "Rules.hpp"
+
+namespace durak::core
+{
+    // The Rules interface as static functions: a type the engine can call without virtual dispatch.
+    template <class P>
+    concept RulesPolicy = requires(GameImpl& g, GameImpl const& cg, PlayerAction const& a, ActionPlan const& plan)
+    {
+        { P::Validate(cg, a) } -> std::same_as<Rules::CheckResult>;
+        { P::Apply(g, a, plan) } -> std::same_as<error::Result<>>;
+        { P::Advance(g) } -> std::same_as<error::Result<MoveOutcome>>;
+    };
+
+    // Virtual Rules over a policy, for code that holds a Rules pointer (server, Judge, replay).
+    template <RulesPolicy P>
+    class PolicyRules final : public Rules
+    {
+    public:
+        auto Validate(GameImpl const& game, PlayerAction const& a) const -> CheckResult override
+        {
+            return P::Validate(game, a);
+        }
+
+        auto Apply(GameImpl& game, PlayerAction const& a, ActionPlan const& plan) -> error::Result<> override
+        {
+            return P::Apply(game, a, plan);
+        }
+
+        auto Advance(GameImpl& game) -> error::Result<MoveOutcome> override { return P::Advance(game); }
+    };
+
+    // GameImpl with the rules fixed at compile time. Resolve/TryResolve on a BasicGame call the policy
+    // directly so the rule checks inline into search and rollout loops; through a GameImpl reference
+    // (or from Step()) the same policy is reached via PolicyRules, so both paths agree.
+    template <RulesPolicy P>
+    class BasicGame final : public GameImpl
+    {
+    public:
+        using Policy = P;
+
+        explicit BasicGame(Config const& config) :
+            GameImpl(config, std::make_unique<PolicyRules<P>>())
+        {
+            CheckShape(config);
+        }
+
+        BasicGame(Config const& config, std::vector<std::unique_ptr<Player>> players) :
+            GameImpl(config, std::make_unique<PolicyRules<P>>(), std::move(players))
+        {
+            CheckShape(config);
+        }
+
+        auto TryResolve(PlayerAction const& action) -> error::Result<MoveOutcome>
+        {
+            return ResolveWith<P>(action);
+        }
+
+        auto Resolve(PlayerAction const& action) -> MoveOutcome
+        {
+            auto const out = TryResolve(action);
+            if (!out) error::raise(out.error());
+            return *out;
+        }
+
+    private:
+        // A policy with a fixed shape folds seat counts to constants, so the game must really have that shape.
+        auto CheckShape(Config const& config) const -> void
+        {
+            if constexpr (requires { typename P::Shape; })
+            {
+                DRK_ASSERT(P::Shape::Fits(PlayerCount(), config.deck36), "Config does not fit the policy's shape");
+            }
+        }
+    };
+}
+
+#endif //IDIOTGAME_BASICGAME_HPP
@@ -0,0 +1,303 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "BatchSim.hpp"
+
+#include "CardMasks.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace durak::core
+{
+    namespace
+    {
+        // CompactMove kinds, widened to lane width
+        constexpr uint64_t KindAttack = CompactMove::Attack;
+        constexpr uint64_t KindDefend = CompactMove::Defend;
+        constexpr uint64_t KindPass = CompactMove::Pass;
+        constexpr uint64_t KindTake = CompactMove::Take;
+
+        constexpr uint64_t PhaseAttacking = std::to_underlying(Phase::Attacking);
+        constexpr uint64_t PhaseDefending = std::to_underlying(Phase::Defending);
+
+        // The kernels below are straight-line mask arithmetic: every select is an AND with a mask from
+        // masks::Any or Below, so the loops over lanes have no control flow and vectorise.
+        using masks::Any;
+        using masks::Cheapest;
+        using masks::Lowest;
+
+        // All ones when a < b (both below 2^63), else zero.
+        constexpr auto Below(uint64_t const a, uint64_t const b) -> uint64_t { return uint64_t{0} - ((a - b) >> 63); }
+
+        // SWAR popcount: AVX2 has no 64-bit vector popcount, std::popcount would keep the loop scalar.
+        constexpr auto Count(uint64_t x) -> uint64_t
+        {
+            x -= (x >> 1) & 0x5555555555555555;
+            x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+            x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0F;
+            x += x >> 8;
+            x += x >> 16;
+            x += x >> 32;
+            return x & 0x7F;
+        }
+
+        // Uid of a one-card mask (64 for an empty one).
+        constexpr auto Id(uint64_t const bit) -> uint64_t { return Count(bit - 1); }
+
+        constexpr auto Min(uint64_t const a, uint64_t const b) -> uint64_t
+        {
+            return (a & Below(a, b)) | (b & ~Below(a, b));
+        }
+    }
+
+    BatchSim::BatchSim(uint8_t const n_players, uint8_t const deal_up_to) :
+        seats_(n_players),
+        deal_up_to_(deal_up_to)
+    {
+        DRK_ASSERT(seats_ >= 2 && seats_ <= constants::MaxPlayers, "BatchSim seat count out of range");
+        loser_.fill(NoSeat);
+    }
+
+    auto BatchSim::Load(size_t const lane, StateImage const& img) -> void
+    {
+        DRK_ASSERT(lane < Lanes, "BatchSim lane out of range");
+        DRK_ASSERT(img.hands.size() == seats_, "StateImage seat count mismatch");
+        DRK_ASSERT(img.deck.size() <= constants::MaxDeckSize, "StateImage deck too large");
+        DRK_ASSERT(img.phase != Phase::Cleanup, "BatchSim loads positions between moves only");
+
+        for (size_t s = 0; s < constants::MaxPlayers; ++s)
+        {
+            hands_[s][lane] = 0;
+            if (s < seats_)
+                for (uint8_t const id : img.hands[s]) hands_[s][lane] |= masks::CardBit(id);
+        }
+        atk_[lane] = def_[lane] = uncovered_[lane] = discard_[lane] = 0;
+        for (size_t i = 0; i < constants::MaxTableSlots; ++i)
+        {
+            if (img.table_atk[i] != StateImage::NoCard)
+            {
+                atk_[lane] |= masks::CardBit(img.table_atk[i]);
+                if (img.table_def[i] == StateImage::NoCard) uncovered_[lane] |= masks::CardBit(img.table_atk[i]);
+            }
+            if (img.table_def[i] != StateImage::NoCard) def_[lane] |= masks::CardBit(img.table_def[i]);
+        }
+        for (uint8_t const id : img.discard) discard_[lane] |= masks::CardBit(id);
+        for (size_t i = 0; i < img.deck.size(); ++i) deck_[i][lane] = img.deck[i];
+        deck_n_[lane] = static_cast<uint8_t>(img.deck.size());
+
+        trumps_[lane] = masks::SuitCards[std::to_underlying(img.trump)];
+        attacker_[lane] = img.attacker_idx;
+        defender_[lane] = img.defender_idx;
+        Fill(lane);
+        phase_[lane] = std::to_underlying(img.phase);
+        bout_cap_[lane] = img.bout_cap;
+        live_[lane] = 1;
+        loser_[lane] = NoSeat;
+    }
+
+    auto BatchSim::Step() -> size_t
+    {
+        acting_ = phase_; // a lane acts once per step, whatever its move changes
+        cleanup_.fill(0);
+        AttackKernel();
+        DefendKernel();
+
+        size_t live = 0;
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+            if (cleanup_[l] != 0) Cleanup(l);
+            live += live_[l];
+        }
+        return live;
+    }
+
+    auto BatchSim::Run(uint16_t const max_plies) -> size_t
+    {
+        size_t live = static_cast<size_t>(std::ranges::count(live_, 1));
+        for (uint16_t ply = 0; ply < max_plies && live != 0; ++ply) live = Step();
+        return live;
+    }
+
+    auto BatchSim::AttackKernel() -> void
+    {
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+            uint64_t const on = Any(live_[l]) & ~Any(acting_[l] ^ PhaseAttacking);
+            uint64_t const atk = atk_[l];
+            uint64_t const table = atk | def_[l];
+            uint64_t const first = ~Any(atk);
+
+            uint64_t const cap_start = Min(constants::MaxTableSlots, Count(def_hand_[l]));
+            uint64_t const cap = (cap_start & first) | (bout_cap_[l] & ~first);
+            uint64_t const ranks = (table | table >> 13 | table >> 26 | table >> 39) & masks::SuitBits;
+            uint64_t const same_rank = first | ranks | ranks << 13 | ranks << 26 | ranks << 39;
+            uint64_t const legal = atk_hand_[l] & same_rank & on & Below(Count(atk), cap);
+            uint64_t const pick = Cheapest(legal, trumps_[l]);
+            uint64_t const picked = Any(pick);
+
+            atk_hand_[l] &= ~pick;
+            atk_[l] = atk | pick;
+            uncovered_[l] |= pick;
+            bout_cap_[l] = (cap_start & first & picked) | (bout_cap_[l] & ~(first & picked));
+            phase_[l] = (PhaseDefending & picked) | (phase_[l] & ~picked);
+            cleanup_[l] |= 1 & on & ~picked;
+
+            move_kind_[l] = (((KindAttack & picked) | (KindPass & ~picked)) & on) | (move_kind_[l] & ~on);
+            move_atk_[l] = (Id(pick) & on) | (move_atk_[l] & ~on);
+        }
+    }
+
+    auto BatchSim::DefendKernel() -> void
+    {
+        alignas(64) PerLane<uint64_t> on;
+        alignas(64) PerLane<uint64_t> rest;
+        alignas(64) PerLane<uint64_t> todo;
+        alignas(64) PerLane<uint64_t> covers{};
+        alignas(64) PerLane<uint64_t> ok;
+        alignas(64) PerLane<uint64_t> atk_ids{};
+        alignas(64) PerLane<uint64_t> def_ids{};
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+            on[l] = Any(live_[l]) & ~Any(acting_[l] ^ PhaseDefending);
+            rest[l] = def_hand_[l];
+            todo[l] = uncovered_[l] & on[l];
+            ok[l] = ~uint64_t{0};
+        }
+
+        // Lowest attack first, each with its cheapest beater among the cards still free. One pass over
+        // the lanes per attack, until no lane has one left; a pass past a lane's last attack leaves it as is.
+        uint64_t left = ~uint64_t{0};
+        for (size_t k = 0; k < constants::MaxTableSlots && left != 0; ++k)
+        {
+            left = 0;
+            for (size_t l = 0; l < Lanes; ++l)
+            {
+                uint64_t const a = Lowest(todo[l]);
+                uint64_t const has = Any(a);
+                uint64_t const d = Cheapest(rest[l] & masks::BeatersOf(a, trumps_[l]), trumps_[l]) & has;
+                ok[l] &= ~has | Any(d);
+                rest[l] &= ~d;
+                covers[l] |= d;
+                todo[l] &= ~a;
+                left |= todo[l];
+                atk_ids[l] |= (Id(a) & has & 0xFF) << (8 * k);
+                def_ids[l] |= (Id(d) & has & 0xFF) << (8 * k);
+            }
+        }
+
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+            uint64_t const cover = on[l] & ok[l];
+            uint64_t const took = on[l] & ~ok[l];
+            move_n_[l] = (Count(uncovered_[l]) & on[l]) | (move_n_[l] & ~on[l]);
+            def_hand_[l] = (rest[l] & cover) | (def_hand_[l] & ~cover);
+            def_[l] |= covers[l] & cover;
+            uncovered_[l] &= ~cover;
+            phase_[l] = (PhaseAttacking & cover) | (phase_[l] & ~cover);
+            cleanup_[l] |= 2 & took;
+
+            move_kind_[l] = (KindDefend & cover) | (KindTake & took) | (move_kind_[l] & ~on[l]);
+            move_atk_[l] = (atk_ids[l] & on[l]) | (move_atk_[l] & ~on[l]);
+            move_def_[l] = (def_ids[l] & on[l]) | (move_def_[l] & ~on[l]);
+        }
+    }
+
+    auto BatchSim::Cleanup(size_t const l) -> void
+    {
+        Spill(l);
+        bool const took = cleanup_[l] == 2;
+        uint64_t const table = atk_[l] | def_[l];
+        if (took) hands_[defender_[l]][l] |= table;
+        else discard_[l] |= table;
+        atk_[l] = def_[l] = uncovered_[l] = 0;
+
+        // Same order as GameImpl::RefillHands: one card per seat per pass, starting with the attacker
+        bool drawn = true;
+        while (drawn)
+        {
+            drawn = false;
+            for (uint8_t offset = 0; offset < seats_ && deck_n_[l] != 0; ++offset)
+            {
+                uint64_t& hand = hands_[(attacker_[l] + offset) % seats_][l];
+                if (std::popcount(hand) >= deal_up_to_) continue;
+                hand |= masks::CardBit(deck_[--deck_n_[l]][l]);
+                drawn = true;
+            }
+        }
+
+        auto next_live = [&](PlyrIdxT from) -> PlyrIdxT
+        {
+            for (size_t j = 0; j < seats_; ++j)
+            {
+                from = static_cast<PlyrIdxT>((from + 1) % seats_);
+                if (hands_[from][l] != 0) return from;
+            }
+            return from;
+        };
+
+        int with_cards = 0;
+        PlyrIdxT holder = NoSeat;
+        for (PlyrIdxT s = 0; s < seats_; ++s)
+        {
+            if (hands_[s][l] == 0) continue;
+            ++with_cards;
+            holder = s;
+        }
+
+        if (with_cards != 0)
+        {
+            attacker_[l] = (took || hands_[defender_[l]][l] == 0) ? next_live(defender_[l]) : defender_[l];
+            defender_[l] = next_live(attacker_[l]);
+        }
+        phase_[l] = PhaseAttacking;
+        Fill(l);
+
+        if (with_cards <= 1)
+        {
+            live_[l] = 0;
+            loser_[l] = with_cards == 1 ? holder : NoSeat;
+        }
+    }
+
+    auto BatchSim::Spill(size_t const lane) -> void
+    {
+        hands_[attacker_[lane]][lane] = atk_hand_[lane];
+        hands_[defender_[lane]][lane] = def_hand_[lane];
+    }
+
+    auto BatchSim::Fill(size_t const lane) -> void
+    {
+        atk_hand_[lane] = hands_[attacker_[lane]][lane];
+        def_hand_[lane] = hands_[defender_[lane]][lane];
+    }
+
+    auto BatchSim::Hand(size_t const lane, PlyrIdxT const seat) const noexcept -> uint64_t
+    {
+        if (seat == attacker_[lane]) return atk_hand_[lane];
+        if (seat == defender_[lane]) return def_hand_[lane];
+        return hands_[seat][lane];
+    }
+
+    auto BatchSim::LastMove(size_t const lane) const -> CompactMove
+    {
+        CompactMove m{.kind = static_cast<uint8_t>(move_kind_[lane])};
+        if (m.kind == KindAttack)
+        {
+            m.n = 1;
+            m.cards[0] = static_cast<uint8_t>(move_atk_[lane]);
+        }
+        else if (m.kind == KindDefend)
+        {
+            m.n = static_cast<uint8_t>(move_n_[lane]);
+            for (size_t i = 0; i < m.n; ++i)
+            {
+                m.cards[2 * i] = static_cast<uint8_t>(move_atk_[lane] >> (8 * i));
+                m.cards[2 * i + 1] = static_cast<uint8_t>(move_def_[lane] >> (8 * i));
+            }
+        }
+        return m;
+    }
+}
@@ -0,0 +1,85 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "BeliefState.hpp"
+
+#include "Util.hpp"
+
+namespace durak::core
+{
+    auto BeliefState::Observe(GameSnapshot const& s, PlyrIdxT const me) -> void
+    {
+        uint64_t table{};
+        for (TableSlotView const& ts : s.table)
+        {
+            if (CardSP const a = ts.attack.lock()) table |= uint64_t{1} << util::CardToUID(*a);
+            if (CardSP const d = ts.defend.lock()) table |= uint64_t{1} << util::CardToUID(*d);
+        }
+        uint64_t mine{};
+        for (CardWP const& w : s.my_hand)
+        {
+            if (CardSP const c = w.lock()) mine |= uint64_t{1} << util::CardToUID(*c);
+        }
+
+        // Visible cards only turn hidden by being picked up: ones on the table last time, or ones we have
+        // since attacked with (we only attack into defender_). Anything else means a new game.
+        uint64_t const visible_before = table_ | mine_;
+        bool const follows = valid_ && me == me_ && s.n_players == n_ &&
+            (s.unseen_mask & ~unseen_ & ~visible_before) == 0;
+        if (!follows)
+        {
+            Reset();
+            me_ = me;
+            n_ = s.n_players;
+            valid_ = true;
+        }
+        else
+        {
+            uint64_t const taken = visible_before & s.unseen_mask;
+            bool const bout_ended = (visible_before & ~(table | mine)) != 0;
+
+            // A bout we never saw (possible with 3+ seats) may have moved known cards between hidden hands.
+            // Only keep attributions when the current bout is the one observed last or its direct successor.
+            auto next_live = [&](PlyrIdxT from) -> PlyrIdxT
+            {
+                for (size_t j = 1; j <= n_; ++j)
+                {
+                    auto const seat = static_cast<PlyrIdxT>((from + j) % n_);
+                    if (seat < s.other_counts.size() && s.other_counts[seat] != 0) return seat;
+                }
+                return from;
+            };
+            PlyrIdxT exp_atk = attacker_;
+            PlyrIdxT exp_def = defender_;
+            if (bout_ended)
+            {
+                bool const def_out = defender_ >= s.other_counts.size() || s.other_counts[defender_] == 0;
+                exp_atk = (taken != 0 || def_out) ? next_live(defender_) : defender_;
+                exp_def = next_live(exp_atk);
+            }
+
+            if (s.attacker_idx != exp_atk || s.defender_idx != exp_def)
+            {
+                known_ = {};
+            }
+            else if (taken != 0)
+            {
+                known_[defender_] |= taken;
+            }
+        }
+
+        for (PlyrIdxT seat = 0; seat < n_; ++seat)
+        {
+            counts_[seat] = seat < s.other_counts.size() ? s.other_counts[seat] : 0;
+            known_[seat] &= s.unseen_mask; // played, discarded, or back on the table
+            if (seat == me_ || std::popcount(known_[seat]) > counts_[seat]) known_[seat] = 0;
+        }
+
+        unseen_ = s.unseen_mask;
+        table_ = table;
+        mine_ = mine;
+        attacker_ = s.attacker_idx;
+        defender_ = s.defender_idx;
+    }
+}
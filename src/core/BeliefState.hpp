@@ -0,0 +1,80 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_BELIEFSTATE_HPP
+#define IDIOTGAME_BELIEFSTATE_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "Game.hpp"
+#include "State.hpp"
+#include "Types.hpp"
+
+namespace durak::core
+{
+    // What one seat can deduce about the hidden cards, as util::CardToUID bitmasks.
+    // Cards picked up by a defender stay attributed to that seat until they show up again (or until a
+    // bout passes unobserved); everything else unseen is spread uniformly over the free hand slots and the deck.
+    class BeliefState
+    {
+    public:
+        // Folds in the next snapshot seen by 'me'. Snapshots may be skipped (e.g. only our own turns);
+        // a snapshot that cannot follow the previous one (new game, other seat) starts over.
+        auto Observe(GameSnapshot const& s, PlyrIdxT me) -> void;
+        auto Reset() -> void { *this = BeliefState{}; }
+
+        auto Known(PlyrIdxT const seat) const noexcept -> uint64_t { return known_[seat]; }
+        auto Unseen() const noexcept -> uint64_t { return unseen_; }
+
+        // Fills every hidden hand of 'img' (sizes from the last snapshot) and a shuffled deck.
+        // Hands and table of the observing seat are left untouched.
+        template <class Rng>
+        auto Sample(Rng& rng, StateImage& img) const -> void
+        {
+            uint64_t known_all{};
+            for (uint64_t const k : known_) known_all |= k;
+
+            std::array<uint8_t, 64> pool{};
+            size_t n{};
+            for (uint64_t m = unseen_ & ~known_all; m; m &= m - 1)
+            {
+                pool[n++] = static_cast<uint8_t>(std::countr_zero(m));
+            }
+            std::shuffle(pool.begin(), pool.begin() + n, rng);
+
+            size_t k{};
+            for (PlyrIdxT seat = 0; seat < n_; ++seat)
+            {
+                if (seat == me_) continue;
+                std::vector<uint8_t>& hand = img.hands[seat];
+                hand.clear();
+                for (uint64_t m = known_[seat]; m; m &= m - 1)
+                {
+                    hand.push_back(static_cast<uint8_t>(std::countr_zero(m)));
+                }
+                size_t const fill = counts_[seat] - hand.size();
+                hand.insert(hand.end(), pool.begin() + k, pool.begin() + k + fill);
+                k += fill;
+            }
+            img.deck.assign(pool.begin() + k, pool.begin() + n);
+        }
+
+    private:
+        PlyrIdxT me_{0};
+        uint8_t n_{0};
+        bool valid_{false};
+        std::array<uint64_t, constants::MaxPlayers> known_{};
+        std::array<uint8_t, constants::MaxPlayers> counts_{};
+        uint64_t unseen_{0};
+        uint64_t table_{0}; // table cards at the last observation
+        uint64_t mine_{0}; // our hand at the last observation
+        PlyrIdxT attacker_{0}; // roles of that bout
+        PlyrIdxT defender_{0};
+    };
+}
+
+#endif //IDIOTGAME_BELIEFSTATE_HPP
@@ -0,0 +1,108 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_CARDMASKS_HPP
+#define IDIOTGAME_CARDMASKS_HPP
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include "Types.hpp"
+
+// Compile-time card-set tables over util::CardToUID bits (suit * 13 + rank), so the rule questions
+// search and rollouts ask most ("what covers this", "what may be added") are one lookup and an AND.
+namespace durak::core::masks
+{
+    inline constexpr uint64_t SuitBits = 0x1FFF;
+
+    constexpr auto CardBit(uint8_t const id) -> uint64_t { return uint64_t{1} << id; }
+
+    // All ones when the set is non-empty, else zero. Shifts and subtracts only: a 64-bit compare has no
+    // SSE2 form, so loops over lanes built from this vectorise without -march.
+    constexpr auto Any(uint64_t const cards) -> uint64_t
+    {
+        return uint64_t{0} - ((cards | (uint64_t{0} - cards)) >> 63);
+    }
+
+    // The four cards of each rank
+    inline constexpr std::array<uint64_t, 13> RankCards = []
+    {
+        std::array<uint64_t, 13> t{};
+        for (uint8_t r = 0; r < 13; ++r)
+        {
+            for (uint8_t s = 0; s < 4; ++s) t[r] |= CardBit(static_cast<uint8_t>(s * 13 + r));
+        }
+        return t;
+    }();
+
+    // The thirteen cards of each suit
+    inline constexpr std::array<uint64_t, 4> SuitCards{SuitBits, SuitBits << 13, SuitBits << 26, SuitBits << 39};
+
+    // BeatersTable[trump][id]: every card that beats card id (ClassicRules::Beats) under that trump.
+    inline constexpr auto BeatersTable = []
+    {
+        std::array<std::array<uint64_t, constants::MaxDeckSize>, 4> t{};
+        for (uint8_t trump = 0; trump < 4; ++trump)
+        {
+            for (uint8_t id = 0; id < constants::MaxDeckSize; ++id)
+            {
+                uint8_t const suit = id / 13;
+                uint64_t const higher = SuitCards[suit] & ~((CardBit(id) << 1) - 1);
+                t[trump][id] = higher | (suit == trump ? 0 : SuitCards[trump]);
+            }
+        }
+        return t;
+    }();
+
+    constexpr auto Beaters(uint8_t const id, Suit const trump) -> uint64_t
+    {
+        return BeatersTable[std::to_underlying(trump)][id];
+    }
+
+    // Beaters computed from a one-card mask and the trump suit's cards: no table lookup and no branch, so a
+    // loop over lanes with different trumps stays gather-free and vectorises. Equal to BeatersTable for any
+    // card; an empty mask gives just the trumps.
+    constexpr auto BeatersOf(uint64_t const card, uint64_t const trumps) -> uint64_t
+    {
+        uint64_t suit = 0;
+        for (uint64_t const s : SuitCards) suit |= s & Any(card & s);
+        uint64_t const higher = suit & ~((card << 1) - 1);
+        return higher | (trumps & ~Any(card & trumps));
+    }
+
+    // True if card d beats card a.
+    constexpr auto Beats(uint8_t const d, uint8_t const a, Suit const trump) -> bool
+    {
+        return (Beaters(a, trump) >> d) & 1u;
+    }
+
+    // 13-bit set of the ranks present in a card mask.
+    constexpr auto RanksOf(uint64_t const cards) -> uint16_t
+    {
+        return static_cast<uint16_t>((cards | cards >> 13 | cards >> 26 | cards >> 39) & SuitBits);
+    }
+
+    // Every card whose rank is in a 13-bit rank set.
+    constexpr auto CardsOfRanks(uint16_t const ranks) -> uint64_t
+    {
+        uint64_t const r = ranks & SuitBits;
+        return r | r << 13 | r << 26 | r << 39;
+    }
+
+    constexpr auto Lowest(uint64_t const cards) -> uint64_t { return cards & (~cards + 1); }
+
+    // Bit of the cheapest card in 'cards' (lowest rank, plain suits before trumps, ties to the lower suit);
+    // the greedy choice BatchSim plays. Branch-free like BeatersOf.
+    constexpr auto Cheapest(uint64_t const cards, uint64_t const trumps) -> uint64_t
+    {
+        uint64_t const plain = cards & ~trumps;
+        uint64_t const ranks = (plain | plain >> 13 | plain >> 26 | plain >> 39) & SuitBits;
+        uint64_t const low = Lowest(ranks);
+        uint64_t const pool = (plain & (low | low << 13 | low << 26 | low << 39)) | (cards & ~Any(plain));
+        return Lowest(pool);
+    }
+}
+
+#endif //IDIOTGAME_CARDMASKS_HPP
@@ -0,0 +1,327 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_CLASSICPOLICY_HPP
+#define IDIOTGAME_CLASSICPOLICY_HPP
+
+#include <algorithm>
+#include <bit>
+#include <ranges>
+
+#include "BasicGame.hpp"
+#include "CardMasks.hpp"
+#include "Game.hpp"
+#include "Util.hpp"
+
+namespace durak::core
+{
+    // Classic (no transfer) Durak as a compile-time rules policy. Everything is defined here so that
+    // BasicGame<ClassicPolicy> inlines the checks; ClassicRules is the virtual adapter over the same code.
+    // S fixes the seat arithmetic (see Shape.hpp); DynamicShape plays any configuration.
+    template <class S = DynamicShape>
+    struct BasicClassicPolicy
+    {
+        using Shape = S;
+
+        static auto Beats(Card const& a, Card const& b, Suit const trump) -> bool
+        {
+            auto const uid = [](Card const& c) { return static_cast<uint8_t>(util::CardToUID(c)); };
+            return masks::Beats(uid(a), uid(b), trump);
+        }
+
+        // Accepts or rejects the action and, when accepted, resolves it to an ActionPlan for Apply.
+        static auto Validate(GameImpl const& game, PlayerAction const& a) -> Rules::CheckResult
+        {
+            using RVC = ::durak::core::error::RuleViolationCode;
+
+            // Actor + bout capacity snapshot
+            PlyrIdxT const actor =
+                (game.phase_ == Phase::Defending) ? game.defender_idx_ : game.attacker_idx_;
+
+            size_t const used = game.masks_.AttacksUsed();
+
+            size_t const cap_start = std::min(constants::MaxTableSlots, game.hands_[game.defender_idx_].size());
+
+            size_t const cap_eff = used == 0 ? cap_start : static_cast<size_t>(game.bout_cap_);
+
+            // Broken invariants, not player errors
+            if (cap_eff > constants::MaxTableSlots || used > cap_eff)
+                return std::unexpected(Viol(RVC::Internal_Unreachable).with_actor(actor));
+
+            size_t const free_slots = (used >= cap_eff) ? 0u : (cap_eff - used);
+
+            return std::visit([&]<typename T0>(T0 const& act) -> Rules::CheckResult
+            {
+                using T = std::decay_t<T0>;
+
+                if constexpr (std::is_same_v<T, AttackAction>)
+                {
+                    if (game.phase_ != Phase::Attacking)
+                        return std::unexpected(Viol(RVC::WrongPhase_AttackingRequired)
+                                               .with_phase(game.phase_).with_actor(actor));
+
+                    if (actor != game.attacker_idx_)
+                        return std::unexpected(Viol(RVC::WrongActor_AttackerRequired)
+                                               .with_actor(actor).with_attacker(game.attacker_idx_));
+
+                    if (act.cards.empty())
+                        return std::unexpected(Viol(RVC::Attack_Empty)
+                                               .with_phase(game.phase_).with_actor(actor));
+
+                    if (act.cards.size() > free_slots)
+                        return std::unexpected(Viol(RVC::Attack_TooManyForCapacity)
+                                               .with_actor(actor)
+                                               .with_phase(game.phase_)
+                                               .with_attempted(static_cast<std::uint8_t>(act.cards.size()))
+                                               .with_cap_free(static_cast<std::uint8_t>(free_slots)));
+
+                    if (util::any_invalid(std::span{act.cards}))
+                        return std::unexpected(Viol(RVC::Attack_PointersInvalid).with_actor(actor));
+
+                    util::CardUniqueChecker checker{};
+                    bool const non_empty_table = (used != 0);
+                    ActionPlan plan{};
+                    auto free_mask = static_cast<uint8_t>(~game.masks_.atk_slots); // cards take free slots in order
+
+                    for (CardWP const& w : act.cards)
+                    {
+                        CCardSP const sp = w.lock();
+                        checker.Add(*sp);
+
+                        auto const idx = game.HandIndexOf(game.attacker_idx_, *sp);
+                        if (!idx)
+                            return std::unexpected(Viol(RVC::Attack_CardNotOwnedByAttacker).with_actor(actor));
+
+                        if (non_empty_table && !game.masks_.RankOnTable(sp->rank))
+                            return std::unexpected(Viol(RVC::Attack_RankNotOnTableWhenRequired)
+                                                   .with_actor(actor).with_rank(sp->rank));
+
+                        plan.placements.push_back({*idx, static_cast<uint8_t>(std::countr_zero(free_mask))});
+                        free_mask &= static_cast<uint8_t>(free_mask - 1);
+                    }
+
+                    if (checker.ContainsDup())
+                        return std::unexpected(Viol(RVC::Attack_DuplicateCards).with_actor(actor));
+
+                    // First attack of the bout pins the cap to the defender's hand size
+                    if (!non_empty_table) plan.pin_cap = static_cast<uint8_t>(cap_start);
+                    SortPlacements(plan);
+                    return plan;
+                }
+                else if constexpr (std::is_same_v<T, DefendAction>)
+                {
+                    if (game.phase_ != Phase::Defending)
+                        return std::unexpected(Viol(RVC::WrongPhase_DefendingRequired)
+                                               .with_phase(game.phase_).with_actor(actor));
+
+                    if (actor != game.defender_idx_)
+                        return std::unexpected(Viol(RVC::WrongActor_DefenderRequired)
+                                               .with_actor(actor).with_defender(game.defender_idx_));
+
+                    if (act.pairs.empty())
+                        return std::unexpected(Viol(RVC::Defend_Empty).with_actor(actor));
+
+                    util::CardUniqueChecker checker{};
+                    ActionPlan plan{};
+
+                    for (DefendPair const& p : act.pairs)
+                    {
+                        if (p.attack.expired() || p.defend.expired())
+                            return std::unexpected(Viol(RVC::Defend_PointersInvalid).with_actor(actor));
+
+                        CCardSP const atk = p.attack.lock();
+                        CCardSP const d = p.defend.lock();
+
+                        checker.Add(*atk);
+                        checker.Add(*d);
+
+                        size_t slot = constants::MaxTableSlots;
+                        for (size_t i = 0; i < game.table_.size(); ++i)
+                        {
+                            TableSlot const& ts = game.table_[i];
+                            if (!ts.attack) continue;
+                            if (*ts.attack != *atk) continue;
+                            if (static_cast<bool>(ts.defend))
+                                return std::unexpected(Viol(RVC::Defend_AttackAlreadyCovered).with_actor(actor));
+                            slot = i;
+                            break;
+                        }
+                        if (slot == constants::MaxTableSlots)
+                            return std::unexpected(Viol(RVC::Defend_AttackNotOnTable).with_actor(actor));
+
+                        auto const idx = game.HandIndexOf(game.defender_idx_, *d);
+                        if (!idx)
+                            return std::unexpected(Viol(RVC::Defend_CardNotOwnedByDefender).with_actor(actor));
+
+                        if (!Beats(*d, *atk, game.trump_))
+                            return std::unexpected(Viol(RVC::Defend_DoesNotBeat).with_actor(actor));
+
+                        plan.placements.push_back({*idx, static_cast<uint8_t>(slot)});
+                    }
+
+                    if (checker.ContainsDup())
+                        return std::unexpected(Viol(RVC::Defend_DuplicateCards).with_actor(actor));
+
+                    std::size_t const uncovered = game.masks_.UncoveredCount();
+
+                    if (uncovered != act.pairs.size())
+                        return std::unexpected(Viol(RVC::Defend_UncoveredPairsMismatch)
+                                               .with_actor(actor)
+                                               .with_attempted(static_cast<std::uint8_t>(act.pairs.size()))
+                                               .with_cap_used(static_cast<std::uint8_t>(uncovered)));
+
+                    SortPlacements(plan);
+                    return plan;
+                }
+                else if constexpr (std::is_same_v<T, PassAction>)
+                {
+                    if (game.phase_ != Phase::Attacking)
+                        return std::unexpected(Viol(RVC::Pass_WrongPhase)
+                                               .with_phase(game.phase_).with_actor(actor));
+
+                    if (actor != game.attacker_idx_)
+                        return std::unexpected(Viol(RVC::Pass_NotAttacker)
+                                               .with_actor(actor).with_attacker(game.attacker_idx_));
+
+                    if (game.masks_.atk_slots == 0)
+                        return std::unexpected(Viol(RVC::Pass_TableEmpty).with_actor(actor));
+
+                    if (game.masks_.Uncovered() != 0)
+                        return std::unexpected(Viol(RVC::Pass_UncoveredRemain).with_actor(actor));
+                    return {};
+                }
+                else if constexpr (std::is_same_v<T, TakeAction>)
+                {
+                    if (game.phase_ != Phase::Defending)
+                        return std::unexpected(Viol(RVC::Take_WrongPhase)
+                                               .with_phase(game.phase_).with_actor(actor));
+
+                    if (actor != game.defender_idx_)
+                        return std::unexpected(Viol(RVC::Take_NotDefender)
+                                               .with_actor(actor).with_defender(game.defender_idx_));
+
+                    return {};
+                }
+
+                return std::unexpected(Viol(RVC::Internal_Unreachable).with_actor(actor));
+            }, a);
+        }
+
+        // Executes Validate's plan for the same state: every card's position is already known.
+        static auto Apply(GameImpl& game, PlayerAction const& a, ActionPlan const& plan) -> error::Result<>
+        {
+            return std::visit([&]<typename T0>(T0 const&) -> error::Result<>
+            {
+                using T = std::decay_t<T0>;
+                if constexpr (std::is_same_v<T, AttackAction>)
+                {
+                    if (plan.pin_cap) game.bout_cap_ = *plan.pin_cap;
+                    for (ActionPlan::Placement const& p : plan.placements)
+                    {
+                        game.PlaceFromHand(game.attacker_idx_, p.hand_idx, p.slot, false);
+                    }
+                    game.phase_ = Phase::Defending;
+                    game.defender_took_ = false;
+                }
+                else if constexpr (std::is_same_v<T, DefendAction>)
+                {
+                    for (ActionPlan::Placement const& p : plan.placements)
+                    {
+                        game.PlaceFromHand(game.defender_idx_, p.hand_idx, p.slot, true);
+                    }
+                    game.phase_ = Phase::Attacking;
+                    game.defender_took_ = false;
+                }
+                else if constexpr (std::is_same_v<T, PassAction>)
+                {
+                    game.phase_ = Phase::Cleanup;
+                }
+                else if constexpr (std::is_same_v<T, TakeAction>)
+                {
+                    game.MoveTableToDefenderHand();
+                    game.phase_ = Phase::Cleanup;
+                    game.defender_took_ = true;
+                }
+                else if constexpr (std::is_same_v<T, TransferAction>)
+                {
+                    DRK_FAIL(::durak::core::error::Code::Rules, "Cannot transfer in classic");
+                }
+                return {};
+            }, a);
+        }
+
+        static auto Advance(GameImpl& game) -> error::Result<MoveOutcome>
+        {
+            using durak::core::error::Code;
+            if (game.phase_ == Phase::Attacking || game.phase_ == Phase::Defending)
+                return MoveOutcome::Applied;
+
+            //clean up phase
+
+            if (game.defender_took_)
+            {
+                //defender took so cards already in hand and off table
+                game.template RefillHands<S>();
+            }
+            else
+            {
+                if (!game.AllAttacksCovered())
+                    DRK_FAIL(Code::State, "Cleanup reached without all attacks covered");
+
+                game.ClearTable();
+
+                game.template RefillHands<S>();
+            }
+
+            int with_cards = 0;
+            for (size_t seat = 0; seat < S::Seats(game.seats_); ++seat)
+                with_cards += !game.hands_[seat].empty();
+
+            // Next roles. Skipped when nobody holds cards (draw): there is no live seat to pick.
+            if (with_cards != 0)
+            {
+                if (game.defender_took_ || game.hands_[game.defender_idx_].empty())
+                {
+                    auto const atk = game.template NextLivePlayer<S>(game.defender_idx_);
+                    if (!atk) return std::unexpected(atk.error());
+                    game.attacker_idx_ = *atk;
+                }
+                else
+                {
+                    game.attacker_idx_ = game.defender_idx_;
+                }
+                auto const def = game.template NextLivePlayer<S>(game.attacker_idx_);
+                if (!def) return std::unexpected(def.error());
+                game.defender_idx_ = *def;
+            }
+
+            game.phase_ = Phase::Attacking;
+            game.defender_took_ = false;
+
+            if (with_cards <= 1) return MoveOutcome::GameEnded;
+
+            return MoveOutcome::RoundEnded;
+        }
+
+    private:
+        static auto Viol(error::RuleViolationCode const code) -> error::RuleViolation
+        {
+            return error::RuleViolation{.code = code};
+        }
+
+        static auto SortPlacements(ActionPlan& plan) -> void
+        {
+            std::ranges::sort(plan.placements, std::ranges::greater{}, &ActionPlan::Placement::hand_idx);
+        }
+    };
+
+    using ClassicPolicy = BasicClassicPolicy<>;
+
+    template <class S>
+    using BasicClassicGame = BasicGame<BasicClassicPolicy<S>>;
+    using ClassicGame = BasicClassicGame<DynamicShape>;
+    using ClassicHeadsUpGame = BasicClassicGame<HeadsUp36>;
+}
+
+#endif //IDIOTGAME_CLASSICPOLICY_HPP
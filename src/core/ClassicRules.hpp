@@ -4,6 +4,8 @@
 
 #ifndef IDIOTGAME_CLASSICRULES_HPP
 #define IDIOTGAME_CLASSICRULES_HPP
+#include <memory>
+
 #include "Rules.hpp"
 
 namespace durak::core
@@ -12,10 +14,14 @@ namespace durak::core
     {
     public:
         auto Validate(GameImpl const& game, PlayerAction const& a) const -> CheckResult override;
-        auto Apply(GameImpl& game, PlayerAction const& a) -> void override;
-        auto Advance(GameImpl& game) -> MoveOutcome override;
+        auto Apply(GameImpl& game, PlayerAction const& a, ActionPlan const& plan) -> error::Result<> override;
+        auto Advance(GameImpl& game) -> error::Result<MoveOutcome> override;
         static bool Beats(Card const& a, Card const& b, Suit const trump);
     };
+
+    // Classic rules for a game configured at run time: the policy fixed to the config's shape when one
+    // fits (see DispatchShape), ClassicRules otherwise.
+    auto MakeClassicRules(Config const& cfg) -> std::unique_ptr<Rules>;
 }
 
 #endif //IDIOTGAME_CLASSICRULES_HPP
\ No newline at end of file
@@ -0,0 +1,70 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_COMPACTMOVE_HPP
+#define IDIOTGAME_COMPACTMOVE_HPP
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+#include "Actions.hpp"
+#include "Game.hpp"
+#include "Types.hpp"
+#include "Util.hpp"
+
+namespace durak::core
+{
+    // A move as card uids, for code that works on card bitmasks (endgame solver, search tree, BatchSim).
+    // kind is the PlayerAction index; cards are one attack uid or atk/def uid pairs.
+    struct CompactMove
+    {
+        static constexpr uint8_t Attack = 0;
+        static constexpr uint8_t Defend = 1;
+        static constexpr uint8_t Transfer = 2;
+        static constexpr uint8_t Pass = 3;
+        static constexpr uint8_t Take = 4;
+
+        uint8_t kind{};
+        uint8_t n{};
+        std::array<uint8_t, 2 * constants::MaxTableSlots> cards{};
+
+        auto operator==(CompactMove const&) const -> bool = default;
+    };
+
+    static_assert(std::is_same_v<std::variant_alternative_t<CompactMove::Attack, PlayerAction>, AttackAction>);
+    static_assert(std::is_same_v<std::variant_alternative_t<CompactMove::Defend, PlayerAction>, DefendAction>);
+    static_assert(std::is_same_v<std::variant_alternative_t<CompactMove::Transfer, PlayerAction>, TransferAction>);
+    static_assert(std::is_same_v<std::variant_alternative_t<CompactMove::Pass, PlayerAction>, PassAction>);
+    static_assert(std::is_same_v<std::variant_alternative_t<CompactMove::Take, PlayerAction>, TakeAction>);
+
+    // The PlayerAction for 'actor' in g, pointing at g's own cards. Transfer is not encoded and maps to Pass.
+    inline auto ToAction(GameImpl const& g, PlyrIdxT const actor, CompactMove const& m) -> PlayerAction
+    {
+        switch (m.kind)
+        {
+        case CompactMove::Attack:
+            return AttackAction{{g.FindFromHand(actor, util::UIDToCard(m.cards[0]))}};
+        case CompactMove::Defend:
+            {
+                DefendAction d{};
+                for (size_t i = 0; i < m.n; ++i)
+                {
+                    d.pairs.push_back(DefendPair{
+                        g.FindFromAtkTable(util::UIDToCard(m.cards[2 * i])),
+                        g.FindFromHand(actor, util::UIDToCard(m.cards[2 * i + 1]))
+                    });
+                }
+                return d;
+            }
+        case CompactMove::Take:
+            return TakeAction{};
+        default:
+            return PassAction{};
+        }
+    }
+}
+
+#endif //IDIOTGAME_COMPACTMOVE_HPP
@@ -0,0 +1,68 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_COUNTERRNG_HPP
+#define IDIOTGAME_COUNTERRNG_HPP
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace durak::core
+{
+    // Counter-based generator (SplitMix64 output function): draw i of a stream is a pure function of
+    // (key, i), so seeding is two words and discard(n) is an add. Streams are addressed by
+    // (run seed, game index, stream), which lets any worker start any game without touching the others.
+    class CounterRng
+    {
+    public:
+        using result_type = uint64_t;
+
+        // Stream ids for SeedFor: seats use their index.
+        static constexpr uint64_t DeckStream = 0xDEC0;
+
+        constexpr CounterRng() noexcept : CounterRng(0)
+        {
+        }
+
+        explicit constexpr CounterRng(uint64_t const seed, uint64_t const counter = 0) noexcept :
+            key_(Mix(seed + Gamma)),
+            counter_(counter)
+        {
+        }
+
+        // Seed for the given stream of game 'game' in run 'run'; unrelated for any two distinct triples.
+        static constexpr auto SeedFor(uint64_t const run, uint64_t const game, uint64_t const stream) noexcept
+            -> uint64_t
+        {
+            return Mix(Mix(Mix(run + Gamma) ^ (game + Gamma)) ^ (stream + Gamma));
+        }
+
+        static constexpr auto min() noexcept -> result_type { return 0; }
+        static constexpr auto max() noexcept -> result_type { return std::numeric_limits<result_type>::max(); }
+
+        constexpr auto operator()() noexcept -> result_type { return Mix(key_ + ++counter_ * Gamma); }
+        constexpr auto discard(uint64_t const n) noexcept -> void { counter_ += n; }
+        constexpr auto Counter() const noexcept -> uint64_t { return counter_; }
+
+        constexpr auto operator==(CounterRng const&) const noexcept -> bool = default;
+
+    private:
+        static constexpr uint64_t Gamma = 0x9E3779B97F4A7C15ull;
+
+        static constexpr auto Mix(uint64_t z) noexcept -> uint64_t
+        {
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        uint64_t key_;
+        uint64_t counter_;
+    };
+
+    static_assert(std::uniform_random_bit_generator<CounterRng>);
+}
+
+#endif //IDIOTGAME_COUNTERRNG_HPP
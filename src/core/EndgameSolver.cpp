@@ -0,0 +1,303 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "EndgameSolver.hpp"
+
+#include "CardMasks.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace durak::core
+{
+    namespace
+    {
+        constexpr uint8_t Resolved = 0xFF;
+        constexpr uint8_t MaxDepth = 250;
+        constexpr uint8_t FlagExact = 0, FlagLower = 1, FlagUpper = 2;
+
+        auto Bit(uint8_t const id) -> uint64_t { return uint64_t{1} << id; }
+
+        auto Cost(uint8_t const id, Suit const trump) -> int
+        {
+            return (id % 13) + ((id / 13) == std::to_underlying(trump) ? 13 : 0);
+        }
+
+        // Cards of 'm' ordered cheapest first.
+        auto Sorted(uint64_t m, Suit const trump) -> std::vector<uint8_t>
+        {
+            std::vector<uint8_t> v;
+            for (; m; m &= m - 1) v.push_back(static_cast<uint8_t>(std::countr_zero(m)));
+            std::ranges::sort(v, {}, [trump](uint8_t id) { return Cost(id, trump); });
+            return v;
+        }
+
+        auto Covers(EndgamePosition const& p, std::vector<uint8_t> const& atk, size_t const i, uint64_t const hand,
+                    CompactMove& cur, std::vector<CompactMove>& out) -> void
+        {
+            if (i == atk.size())
+            {
+                out.push_back(cur);
+                return;
+            }
+            for (uint8_t const d : Sorted(hand & masks::Beaters(atk[i], p.trump), p.trump))
+            {
+                cur.cards[2 * i] = atk[i];
+                cur.cards[2 * i + 1] = d;
+                Covers(p, atk, i + 1, hand & ~Bit(d), cur, out);
+            }
+        }
+
+        // Legal moves, roughly best first: cheap cards before expensive ones, Take last.
+        auto GenMoves(EndgamePosition const& p, std::vector<CompactMove>& out) -> void
+        {
+            out.clear();
+            PlyrIdxT const atk = p.attacker;
+            PlyrIdxT const def = 1 - atk;
+
+            if (p.phase == Phase::Attacking)
+            {
+                size_t const cap = (p.used == 0)
+                                       ? std::min<size_t>(constants::MaxTableSlots, std::popcount(p.hands[def]))
+                                       : p.bout_cap;
+                if (p.used < cap)
+                {
+                    uint64_t const playable = p.used == 0 ? p.hands[atk]
+                                                          : p.hands[atk] & masks::CardsOfRanks(masks::RanksOf(p.table));
+                    for (uint8_t const c : Sorted(playable, p.trump))
+                    {
+                        out.push_back(CompactMove{CompactMove::Attack, 1, {c}});
+                    }
+                }
+                if (p.used != 0) out.push_back(CompactMove{CompactMove::Pass});
+                return;
+            }
+
+            std::vector<uint8_t> const atk_cards = Sorted(p.uncovered, p.trump);
+            CompactMove cur{CompactMove::Defend, static_cast<uint8_t>(atk_cards.size())};
+            Covers(p, atk_cards, 0, p.hands[def], cur, out);
+            out.push_back(CompactMove{CompactMove::Take});
+        }
+
+        // Plays 'm' for the side to move, mirroring ClassicRules::Apply/Advance for two seats and no deck.
+        // Returns true when the game ended, with the result for the mover in 'value'.
+        auto Apply(EndgamePosition& p, CompactMove const& m, int& value) -> bool
+        {
+            PlyrIdxT const atk = p.attacker;
+            PlyrIdxT const def = 1 - atk;
+            PlyrIdxT const mover = p.ToMove();
+
+            switch (m.kind)
+            {
+            case CompactMove::Attack:
+                if (p.used == 0)
+                {
+                    p.bout_cap = static_cast<uint8_t>(std::min<size_t>(constants::MaxTableSlots,
+                                                                       std::popcount(p.hands[def])));
+                }
+                p.hands[atk] &= ~Bit(m.cards[0]);
+                p.table |= Bit(m.cards[0]);
+                p.uncovered |= Bit(m.cards[0]);
+                ++p.used;
+                p.phase = Phase::Defending;
+                return false;
+            case CompactMove::Defend:
+                for (size_t i = 0; i < m.n; ++i)
+                {
+                    p.hands[def] &= ~Bit(m.cards[2 * i + 1]);
+                    p.table |= Bit(m.cards[2 * i + 1]);
+                }
+                p.uncovered = 0;
+                p.phase = Phase::Attacking;
+                return false;
+            case CompactMove::Take:
+                p.hands[def] |= p.table;
+                p.attacker = atk; // next live seat after the defender
+                break;
+            default: // Pass: beaten cards are discarded, the defender attacks next
+                p.attacker = (p.hands[def] != 0) ? def : atk;
+                break;
+            }
+
+            p.table = 0;
+            p.uncovered = 0;
+            p.used = 0;
+            p.phase = Phase::Attacking;
+
+            if (p.hands[0] != 0 && p.hands[1] != 0) return false;
+            if (p.hands[0] == 0 && p.hands[1] == 0) value = 0;
+            else value = (p.hands[mover] != 0) ? -EndgameSolver::Win : EndgameSolver::Win;
+            return true;
+        }
+
+        auto Heuristic(EndgamePosition const& p) -> int
+        {
+            PlyrIdxT const me = p.ToMove();
+            int const diff = std::popcount(p.hands[1 - me]) - std::popcount(p.hands[me]);
+            return std::clamp(diff * 10, -EndgameSolver::Win / 2, EndgameSolver::Win / 2);
+        }
+
+        auto Keys(EndgamePosition const& p) -> std::array<uint64_t, 4>
+        {
+            uint64_t const misc = (uint64_t{p.attacker} << 52) | (uint64_t{std::to_underlying(p.phase)} << 53) |
+                (uint64_t{p.bout_cap} << 55) | (uint64_t{p.used} << 58) |
+                (uint64_t{std::to_underlying(p.trump)} << 61);
+            return {p.hands[0], p.hands[1], p.table | misc, p.uncovered};
+        }
+    }
+
+    auto EndgamePosition::From(StateImage const& img) -> std::optional<EndgamePosition>
+    {
+        if (img.hands.size() != 2 || !img.deck.empty() || img.phase == Phase::Cleanup) return std::nullopt;
+
+        EndgamePosition p{};
+        for (size_t s = 0; s < 2; ++s)
+        {
+            for (uint8_t const id : img.hands[s]) p.hands[s] |= Bit(id);
+        }
+        for (size_t i = 0; i < constants::MaxTableSlots; ++i)
+        {
+            if (img.table_atk[i] != StateImage::NoCard)
+            {
+                p.table |= Bit(img.table_atk[i]);
+                ++p.used;
+                if (img.table_def[i] == StateImage::NoCard) p.uncovered |= Bit(img.table_atk[i]);
+            }
+            if (img.table_def[i] != StateImage::NoCard) p.table |= Bit(img.table_def[i]);
+        }
+        p.trump = img.trump;
+        p.attacker = img.attacker_idx;
+        p.phase = img.phase;
+        p.bout_cap = img.bout_cap;
+        return p;
+    }
+
+    EndgameSolver::EndgameSolver(uint8_t const tt_bits) :
+        tt_(size_t{1} << tt_bits),
+        mask_((uint64_t{1} << tt_bits) - 1)
+    {
+    }
+
+    auto EndgameSolver::Probe(EndgamePosition const& p) -> Entry&
+    {
+        auto const k = Keys(p);
+        uint64_t h = k[0] * 0x9E3779B97F4A7C15ull;
+        h ^= std::rotl(k[1] * 0xC2B2AE3D27D4EB4Full, 17);
+        h ^= std::rotl(k[2] * 0x165667B19E3779F9ull, 31);
+        h ^= std::rotl(k[3] * 0x27D4EB2F165667C5ull, 47);
+        h ^= h >> 29;
+        return tt_[h & mask_];
+    }
+
+    auto EndgameSolver::Search(EndgamePosition const& p, uint8_t const depth, int alpha, int const beta) -> Score
+    {
+        if ((++nodes_ & 1023u) == 0 && std::chrono::steady_clock::now() >= deadline_) aborted_ = true;
+        if (aborted_) return {0, false};
+
+        auto const k = Keys(p);
+        Entry& e = Probe(p);
+        bool const hit = e.k0 == k[0] && e.k1 == k[1] && e.k2 == k[2] && e.k3 == k[3];
+        if (hit && (e.depth == Resolved || e.depth >= depth))
+        {
+            bool const proven = e.depth == Resolved;
+            if (e.flag == FlagExact) return {e.value, proven};
+            if (e.flag == FlagLower && e.value >= beta) return {e.value, proven};
+            if (e.flag == FlagUpper && e.value <= alpha) return {e.value, proven};
+        }
+        if (depth == 0) return {Heuristic(p), false};
+
+        std::vector<CompactMove> moves;
+        GenMoves(p, moves);
+        uint8_t const tt_best = hit ? e.best : uint8_t{0xFF};
+        if (tt_best < moves.size()) std::swap(moves[0], moves[tt_best]);
+
+        int const alpha0 = alpha;
+        int best = -Win - 1;
+        size_t best_i = 0;
+        bool all_resolved = true;
+        bool cut = false;
+
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            EndgamePosition child = p;
+            int value{};
+            Score s{};
+            if (Apply(child, moves[i], value))
+            {
+                s = {value, true};
+            }
+            else if (child.ToMove() == p.ToMove())
+            {
+                s = Search(child, depth - 1, alpha, beta);
+            }
+            else
+            {
+                Score const c = Search(child, depth - 1, -beta, -alpha);
+                s = {-c.value, c.resolved};
+            }
+            if (aborted_) return {0, false};
+
+            if (s.value > best)
+            {
+                best = s.value;
+                best_i = i;
+            }
+            if (s.resolved && s.value == Win)
+            {
+                all_resolved = true; // nothing can beat a proven win, whatever the other moves hold
+                break;
+            }
+            alpha = std::max(alpha, best);
+            if (alpha >= beta)
+            {
+                all_resolved = s.resolved; // the refutation alone proves the bound
+                cut = true;
+                break;
+            }
+            all_resolved &= s.resolved;
+        }
+
+        // Undo the TT-move swap so the stored index matches a fresh GenMoves
+        if (tt_best < moves.size() && (best_i == 0 || best_i == tt_best)) best_i = (best_i == 0) ? tt_best : 0;
+
+        Entry& slot = Probe(p);
+        slot.k0 = k[0];
+        slot.k1 = k[1];
+        slot.k2 = k[2];
+        slot.k3 = k[3];
+        slot.value = static_cast<int16_t>(best);
+        slot.depth = all_resolved ? Resolved : depth;
+        slot.flag = cut ? FlagLower : (best <= alpha0 ? FlagUpper : FlagExact);
+        slot.best = static_cast<uint8_t>(best_i);
+        return {best, all_resolved};
+    }
+
+    auto EndgameSolver::Solve(EndgamePosition const& root, std::chrono::steady_clock::time_point const deadline)
+        -> std::optional<Result>
+    {
+        deadline_ = deadline;
+        aborted_ = false;
+        nodes_ = 0;
+
+        std::optional<Result> out;
+        std::vector<CompactMove> moves;
+        GenMoves(root, moves);
+        if (moves.empty()) return out;
+
+        for (uint8_t depth = 1; depth <= MaxDepth; ++depth)
+        {
+            Score const s = Search(root, depth, -Win - 1, Win + 1);
+            if (aborted_) break;
+
+            auto const k = Keys(root);
+            Entry const& e = Probe(root);
+            bool const hit = e.k0 == k[0] && e.k1 == k[1] && e.k2 == k[2] && e.k3 == k[3];
+            CompactMove const best = (hit && e.best < moves.size()) ? moves[e.best] : moves.front();
+            out = Result{best, s.value, s.resolved, depth, nodes_};
+            if (s.resolved) break;
+        }
+        return out;
+    }
+}
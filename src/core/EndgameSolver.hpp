@@ -0,0 +1,89 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_ENDGAMESOLVER_HPP
+#define IDIOTGAME_ENDGAMESOLVER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "CompactMove.hpp"
+#include "Game.hpp"
+#include "Types.hpp"
+
+namespace durak::core
+{
+    // Heads-up, empty-deck position: nothing is hidden any more. Cards are util::CardToUID bits.
+    struct EndgamePosition
+    {
+        std::array<uint64_t, 2> hands{};
+        uint64_t table{0}; // every card on the table
+        uint64_t uncovered{0}; // attack cards not yet beaten
+        Suit trump{Suit::Spades};
+        PlyrIdxT attacker{0};
+        Phase phase{Phase::Attacking};
+        uint8_t bout_cap{constants::MaxTableSlots};
+        uint8_t used{0}; // attack cards on the table
+
+        auto ToMove() const noexcept -> PlyrIdxT { return phase == Phase::Defending ? 1 - attacker : attacker; }
+
+        // Empty when the image is not a two-seat game with an empty deck.
+        static auto From(StateImage const& img) -> std::optional<EndgamePosition>;
+    };
+
+    // Negamax alpha-beta with a transposition table and iterative deepening.
+    // Attacks are searched one card at a time: following up with a second card of the rank is always
+    // available, so this never undervalues the attacker. Scores are from the side to move:
+    // +Win / -Win once proven, 0 for a draw, hand-size guesses in between.
+    class EndgameSolver
+    {
+    public:
+        static constexpr int Win = 1000;
+
+        struct Result
+        {
+            CompactMove move{};
+            int value{0};
+            bool solved{false}; // value is exact, not a depth-limited guess
+            uint16_t depth{0}; // deepest completed iteration
+            uint64_t nodes{0};
+        };
+
+        explicit EndgameSolver(uint8_t tt_bits = 18);
+
+        // Empty if not even depth 1 completed before the deadline.
+        auto Solve(EndgamePosition const& root, std::chrono::steady_clock::time_point deadline)
+            -> std::optional<Result>;
+
+    private:
+        struct Entry
+        {
+            uint64_t k0{}, k1{}, k2{}, k3{};
+            int16_t value{};
+            uint8_t depth{}; // Resolved = proven regardless of depth
+            uint8_t flag{};
+            uint8_t best{0xFF}; // index into the generated move list
+        };
+
+        struct Score
+        {
+            int value;
+            bool resolved;
+        };
+
+        auto Search(EndgamePosition const& p, uint8_t depth, int alpha, int beta) -> Score;
+        auto Probe(EndgamePosition const& p) -> Entry&;
+
+        std::vector<Entry> tt_;
+        uint64_t mask_;
+        uint64_t nodes_{0};
+        bool aborted_{false};
+        std::chrono::steady_clock::time_point deadline_{};
+    };
+}
+
+#endif //IDIOTGAME_ENDGAMESOLVER_HPP
@@ -7,8 +7,16 @@
 
 #include "OmegaException.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
 #include <expected>
+#include <source_location>
 #include <stdexcept>
+#include <string_view>
 #include <format>
 #include <utility>
 #include "Types.hpp"
@@ -75,26 +83,133 @@ namespace durak::core::error
         using OmegaException<Code>::OmegaException;
     };
 
+    // Per-Code limit on stack captures (GCRA token bucket). Exceptions are always thrown;
+    // once a code exceeds its budget they are just thrown without a stack.
+    class CaptureLimiter
+    {
+    public:
+        static constexpr std::size_t CodeCount = static_cast<std::size_t>(Code::Assertion) + 1;
+
+        // per_second == 0 disables limiting.
+        auto Configure(std::uint32_t const per_second, std::uint32_t const burst) noexcept -> void
+        {
+            std::int64_t const interval = per_second == 0 ? 0 : 1'000'000'000LL / per_second;
+            interval_ns_.store(interval, std::memory_order_relaxed);
+            window_ns_.store(interval * (burst == 0 ? 0 : burst - 1), std::memory_order_relaxed);
+        }
+
+        auto Admit(Code const c) noexcept -> bool
+        {
+            std::int64_t const interval = interval_ns_.load(std::memory_order_relaxed);
+            if (interval == 0) return true;
+
+            std::int64_t const window = window_ns_.load(std::memory_order_relaxed);
+            std::int64_t const now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+
+            Bucket& b = buckets_[static_cast<std::size_t>(c) % CodeCount];
+            std::int64_t tat = b.tat_ns.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                std::int64_t const base = std::max(tat, now);
+                if (base - now > window)
+                {
+                    b.suppressed.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                if (b.tat_ns.compare_exchange_weak(tat, base + interval, std::memory_order_relaxed))
+                    return true;
+            }
+        }
+
+        auto Suppressed(Code const c) const noexcept -> std::uint64_t
+        {
+            return buckets_[static_cast<std::size_t>(c) % CodeCount].suppressed.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct Bucket
+        {
+            std::atomic<std::int64_t> tat_ns{0}; // theoretical arrival time of the next capture
+            std::atomic<std::uint64_t> suppressed{0};
+        };
+
+        std::atomic<std::int64_t> interval_ns_{1'000'000'000LL / 20};
+        std::atomic<std::int64_t> window_ns_{1'000'000'000LL / 20 * 19};
+        std::array<Bucket, CodeCount> buckets_{};
+    };
+
+    inline auto Limiter() noexcept -> CaptureLimiter&
+    {
+        static CaptureLimiter limiter{};
+        return limiter;
+    }
+
+    // Default: 20 captures/s per code with a burst of 20.
+    inline auto SetStackCaptureRate(std::uint32_t const per_second, std::uint32_t const burst) noexcept -> void
+    {
+        Limiter().Configure(per_second, burst);
+    }
+
+#if DRK_ALLOW_EXCEPTIONS
     [[noreturn]]
-    inline auto fail(Code c, std::string msg) -> void
+    inline auto fail(Code c, std::string msg,
+                     std::source_location const& loc = std::source_location::current()) -> void
     {
+        StackCapture const cap = Limiter().Admit(c) ? GetStackCapture() : StackCapture::Off;
         switch (c)
         {
-        case Code::Unknown: throw UnknownError(std::move(msg), c);
-        case Code::Rules: throw RulesError(std::move(msg), c);
-        case Code::State: throw StateError(std::move(msg), c);
-        case Code::InvalidAction: throw InvalidActionError(std::move(msg), c);
-        case Code::Timeout: throw TimeoutError(std::move(msg), c);
-        case Code::Network: throw NetworkError(std::move(msg), c);
-        case Code::Serialization: throw SerializationError(std::move(msg), c);
-        case Code::Assertion: throw AssertionError(std::move(msg), c);
+        case Code::Unknown: throw UnknownError(std::move(msg), c, loc, cap);
+        case Code::Rules: throw RulesError(std::move(msg), c, loc, cap);
+        case Code::State: throw StateError(std::move(msg), c, loc, cap);
+        case Code::InvalidAction: throw InvalidActionError(std::move(msg), c, loc, cap);
+        case Code::Timeout: throw TimeoutError(std::move(msg), c, loc, cap);
+        case Code::Network: throw NetworkError(std::move(msg), c, loc, cap);
+        case Code::Serialization: throw SerializationError(std::move(msg), c, loc, cap);
+        case Code::Assertion: throw AssertionError(std::move(msg), c, loc, cap);
         }
         throw std::runtime_error(msg);
     }
+#else
+    // No exceptions: report and abort. Recoverable engine errors never get here (they are Results).
+    [[noreturn]]
+    inline auto fail(Code c, std::string msg,
+                     std::source_location const& loc = std::source_location::current()) -> void
+    {
+        std::fprintf(stderr, "durak: fatal error (code %u) at %s:%u: %s\n",
+                     static_cast<unsigned>(c), loc.file_name(), static_cast<unsigned>(loc.line()), msg.c_str());
+        std::abort();
+    }
+#endif
+
+    // Engine error as a value: what core functions return instead of throwing.
+    struct EngineError
+    {
+        Code code{Code::Unknown};
+        std::string_view msg{}; // string literal
+        std::source_location where{};
+    };
+
+    template <typename T = void>
+    using Result = std::expected<T, EngineError>;
+
+    // Escalate an EngineError the classic way (throw, or abort when exceptions are off).
+    [[noreturn]]
+    inline auto raise(EngineError const& e) -> void
+    {
+        fail(e.code, std::string(e.msg), e.where);
+    }
 
 #define DRK_THROW(code_enum, msg) ::durak::core::error::fail((code_enum), (msg))
 #define DRK_ASSERT(cond, msg) do { if(!(cond)) ::durak::core::error::fail(::durak::core::error::Code::Assertion, (msg)); } while(0)
 
+// Result-returning counterparts (usable with exceptions disabled)
+#define DRK_FAIL(code_enum, msg) \
+    return std::unexpected(::durak::core::error::EngineError{(code_enum), (msg), std::source_location::current()})
+#define DRK_CHECK(cond, msg) do { if(!(cond)) DRK_FAIL(::durak::core::error::Code::Assertion, (msg)); } while(0)
+#define DRK_TRY(expr) \
+    do { if(auto&& drk_try_res_ = (expr); !drk_try_res_.has_value()) return std::unexpected(drk_try_res_.error()); } while(0)
+
     // Fine-grained reasons; grouped by action type.
     enum class RuleViolationCode : std::uint16_t
     {
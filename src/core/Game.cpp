@@ -4,25 +4,51 @@
 #include "Game.hpp"
 #include <ranges>
 
+#include "CounterRng.hpp"
 #include "Util.hpp"
-#include <print>
 #include <utility>
 
 namespace durak::core
 {
+    static auto Bit(Card const& c) -> uint64_t
+    {
+        return uint64_t{1} << util::CardToUID(c);
+    }
+
+    static auto RankBit(Card const& c) -> uint16_t
+    {
+        return static_cast<uint16_t>(1u << static_cast<unsigned>(c.rank));
+    }
+
     GameImpl::GameImpl(Config const& config,
                        std::unique_ptr<Rules> rules,
                        std::vector<std::unique_ptr<Player>> players) :
         cfg_(config),
         rules_(std::move(rules)),
         players_(std::move(players)),
-        rng_{cfg_.seed},
-        judge_(std::make_shared<Judge>()),
-        hands_(players_.size())
+        judge_(std::make_shared<Judge>())
     {
         DRK_ASSERT(players_.size() >= 2, "Less than 2 players while initalising core");
+        DRK_ASSERT(players_.size() <= constants::MaxPlayers, "More than MaxPlayers while initalising core");
         DRK_ASSERT(!std::ranges::any_of(players_,
                                         [](std::unique_ptr<Player> const& p) { return !p; }), "Invalid player in core");
+        seats_ = static_cast<uint8_t>(players_.size());
+        BuildDeck();
+        DRK_ASSERT(!deck_.empty(), "Empty deck after attempting init of deck in core");
+        trump_ = deck_.back()->suit;
+        DealInitalHands();
+        ChoseInitalRoles();
+    }
+
+    GameImpl::GameImpl(Config const& config,
+                       std::unique_ptr<Rules> rules) :
+        cfg_(config),
+        rules_(std::move(rules)),
+        judge_(std::make_shared<Judge>())
+    {
+        DRK_ASSERT(cfg_.n_players >= 2, "Less than 2 players while initalising core");
+        DRK_ASSERT(cfg_.n_players <= constants::MaxPlayers, "More than MaxPlayers while initalising core");
+        seats_ = static_cast<uint8_t>(cfg_.n_players);
         BuildDeck();
         DRK_ASSERT(!deck_.empty(), "Empty deck after attempting init of deck in core");
         trump_ = deck_.back()->suit;
@@ -32,37 +58,72 @@ namespace durak::core
 
     auto GameImpl::BuildDeck() -> void
     {
+        std::span<uint8_t const> const ids = cfg_.deck36
+                                                 ? std::span<uint8_t const>{DeckTemplate<true>}
+                                                 : std::span<uint8_t const>{DeckTemplate<false>};
         deck_.clear();
-        //branchless init
-        size_t const rank_start = cfg_.deck36 * static_cast<size_t>(Rank::Six);
-        constexpr size_t rank_end = static_cast<size_t>(Rank::Ace) + 1;
-        for (size_t i{}; i < 4; ++i)
+        deck_.reserve(ids.size());
+        for (uint8_t const id : ids)
         {
-            for (size_t j{rank_start}; j < rank_end; ++j)
-            {
-                deck_.emplace_back(std::make_shared<Card>(
-                    static_cast<Suit>(i), static_cast<Rank>(j)));
-            }
+            deck_.emplace_back(std::make_shared<Card>(util::UIDToSuit(id), util::UIDToRank(id)));
+        }
+        masks_.deck = cfg_.deck36 ? DeckMask<true> : DeckMask<false>;
+        // Seeded here, once per game: the counter generator costs two words, mt19937_64 2.5 KB
+        if (cfg_.counter_rng)
+        {
+            std::ranges::shuffle(deck_, CounterRng{cfg_.seed});
+        }
+        else
+        {
+            std::ranges::shuffle(deck_, std::mt19937_64{cfg_.seed});
         }
-        std::ranges::shuffle(deck_, rng_);
     }
 
     auto GameImpl::DealInitalHands() -> void
     {
         size_t target = cfg_.deal_up_to;
-        DRK_ASSERT(target * hands_.size() <= deck_.size(), "Less cards in deck than required to init player hands");
+        DRK_ASSERT(target * seats_ <= deck_.size(), "Less cards in deck than required to init player hands");
         //will not deal round robin as with a randomly shuffled deck
         //dealing order should not matter.
-        for (auto& hand : hands_)
+        for (size_t s = 0; s < seats_; ++s)
         {
+            std::vector<CardSP>& hand = hands_[s];
+            uint64_t& hand_mask = masks_.hands[s];
             while (hand.size() < target)
             {
+                uint64_t const bit = Bit(*deck_.back());
+                masks_.deck &= ~bit;
+                hand_mask |= bit;
                 hand.push_back(std::move(deck_.back()));
                 deck_.pop_back();
             }
         }
     }
 
+    auto GameImpl::RebuildMasks() -> void
+    {
+        masks_ = ZoneMasks{};
+        for (size_t s = 0; s < seats_; ++s)
+            for (CardSP const& c : hands_[s]) masks_.hands[s] |= Bit(*c);
+        for (CardSP const& c : deck_) masks_.deck |= Bit(*c);
+        for (CardSP const& c : discard_) masks_.discard |= Bit(*c);
+        for (size_t i = 0; i < table_.size(); ++i)
+        {
+            if (table_[i].attack)
+            {
+                masks_.table |= Bit(*table_[i].attack);
+                masks_.table_ranks |= RankBit(*table_[i].attack);
+                masks_.atk_slots |= static_cast<uint8_t>(1u << i);
+            }
+            if (table_[i].defend)
+            {
+                masks_.table |= Bit(*table_[i].defend);
+                masks_.table_ranks |= RankBit(*table_[i].defend);
+                masks_.def_slots |= static_cast<uint8_t>(1u << i);
+            }
+        }
+    }
+
     auto GameImpl::ChoseInitalRoles() -> void
     {
         attacker_idx_ = 0;
@@ -94,7 +155,7 @@ namespace durak::core
     {
         std::shared_ptr<GameSnapshot> snap = std::make_shared<GameSnapshot>();
         snap->trump = trump_;
-        snap->n_players = players_.size();
+        snap->n_players = seats_;
         snap->attacker_idx = attacker_idx_;
         snap->defender_idx = defender_idx_;
         snap->phase = phase_;
@@ -103,17 +164,23 @@ namespace durak::core
         snap->table = MakeViewTable(table_);
         snap->my_hand = std::move(Shared_to_weak(hands_[seat]));
 
-        for (auto const& hand : hands_)
+        for (size_t s = 0; s < seats_; ++s)
         {
-            snap->other_counts.push_back(hand.size());
+            snap->other_counts.push_back(hands_[s].size());
         }
-        auto used = static_cast<uint8_t>(
-            std::ranges::count_if(table_, [](auto const& ts) { return static_cast<bool>(ts.attack); })
-        );
         snap->bout_cap = bout_cap_;
-        snap->attacks_used = used;
+        snap->attacks_used = static_cast<uint8_t>(masks_.AttacksUsed());
+        snap->table_ranks = masks_.table_ranks;
         snap->defender_took = defender_took_;
 
+        snap->deck_count = static_cast<uint8_t>(deck_.size());
+        snap->deal_up_to = cfg_.deal_up_to;
+        snap->unseen_mask = masks_.deck;
+        for (size_t s = 0; s < seats_; ++s)
+        {
+            if (s != seat) snap->unseen_mask |= masks_.hands[s];
+        }
+
         return snap;
     }
 
@@ -124,6 +191,13 @@ namespace durak::core
         return (it != std::cend(hands_[seat])) ? CardWP{*it} : CardWP{};
     }
 
+    auto GameImpl::HandIndexOf(PlyrIdxT const seat, Card const& c) const -> std::optional<uint8_t>
+    {
+        auto const it = std::ranges::find_if(hands_[seat], [&c](CardSP const& csp) { return c == *csp; });
+        if (it == std::cend(hands_[seat])) return std::nullopt;
+        return static_cast<uint8_t>(it - std::cbegin(hands_[seat]));
+    }
+
     auto GameImpl::FindFromAtkTable(Card const& c) const -> CardWP
     {
         auto const it = std::ranges::find_if(std::as_const(table_),
@@ -135,12 +209,13 @@ namespace durak::core
         return (it != std::cend(table_)) ? CardWP{it->attack} : CardWP{};
     }
 
-    auto GameImpl::MoveHandToTable(PlyrIdxT const seat, CardWP const& atk, CardWP const& def) -> void
+    auto GameImpl::MoveHandToTable(PlyrIdxT const seat, CardWP const& atk, CardWP const& def) -> error::Result<>
     {
-        DRK_ASSERT(!atk.expired(), "Attacker card null (Should never happen)");
+        DRK_CHECK(!atk.expired(), "Attacker card null (Should never happen)");
+        DRK_CHECK(seat < seats_, "Seat out of range");
 
         CCardSP atk_card = atk.lock();
-        auto& hand = hands_.at(seat);
+        auto& hand = hands_[seat];
         //if defender card not present, the intended request is interpreted as an attacker
         //conducting an attack
         if (def.expired())
@@ -150,15 +225,19 @@ namespace durak::core
                 {
                     return *csp == *atk_card;
                 });
-            DRK_ASSERT(it != std::end(hand), "Attacker card not in hand");
-
-            auto const free_slot_it = std::ranges::find_if(table_,
-                                                           [](TableSlot const& s) { return !(s.attack); });
-
-            if (free_slot_it == std::end(table_))
-                DRK_THROW(durak::core::error::Code::State, "No free table slots");
-
-            free_slot_it->attack = std::move(*it);
+            DRK_CHECK(it != std::end(hand), "Attacker card not in hand");
+
+            // First free slot = lowest clear bit of the occupancy mask
+            auto const free_slot = static_cast<size_t>(std::countr_one(masks_.atk_slots));
+            if (free_slot >= table_.size())
+                DRK_FAIL(durak::core::error::Code::State, "No free table slots");
+
+            uint64_t const bit = Bit(**it);
+            masks_.hands[seat] &= ~bit;
+            masks_.table |= bit;
+            masks_.table_ranks |= RankBit(**it);
+            masks_.atk_slots |= static_cast<uint8_t>(1u << free_slot);
+            table_[free_slot].attack = std::move(*it);
             hand.erase(it);
         }
         else
@@ -170,7 +249,7 @@ namespace durak::core
                     return *csp == *def_card;
                 });
 
-            DRK_ASSERT(it != std::end(hand), "Defender card not in hand");
+            DRK_CHECK(it != std::end(hand), "Defender card not in hand");
 
             auto const cover_slot_it = std::ranges::find_if(table_,
                                                             [&](TableSlot const& s)
@@ -178,14 +257,20 @@ namespace durak::core
                                                                 return s.attack && *s.attack == *atk_card;
                                                             });
 
-            if (cover_slot_it == std::end(table_)) DRK_THROW(durak::core::error::Code::State,
-                                                             "Card which you attempt to cover doesn't exist");
-            if (cover_slot_it->defend) DRK_THROW(durak::core::error::Code::State,
-                                                 "Card which you attempt to cover is already covered");
+            if (cover_slot_it == std::end(table_)) DRK_FAIL(durak::core::error::Code::State,
+                                                            "Card which you attempt to cover doesn't exist");
+            if (cover_slot_it->defend) DRK_FAIL(durak::core::error::Code::State,
+                                                "Card which you attempt to cover is already covered");
 
+            uint64_t const bit = Bit(**it);
+            masks_.hands[seat] &= ~bit;
+            masks_.table |= bit;
+            masks_.table_ranks |= RankBit(**it);
+            masks_.def_slots |= static_cast<uint8_t>(1u << (cover_slot_it - std::begin(table_)));
             cover_slot_it->defend = std::move(*it);
             hand.erase(it);
         }
+        return {};
     }
 
     auto GameImpl::ClearTable() -> void
@@ -200,6 +285,11 @@ namespace durak::core
             attack.reset();
             defend.reset();
         }
+        masks_.discard |= masks_.table;
+        masks_.table = 0;
+        masks_.table_ranks = 0;
+        masks_.atk_slots = 0;
+        masks_.def_slots = 0;
     }
 
     auto GameImpl::MoveTableToDefenderHand() -> void
@@ -212,67 +302,124 @@ namespace durak::core
             ts.attack.reset();
             ts.defend.reset();
         }
+        masks_.hands[defender_idx_] |= masks_.table;
+        masks_.table = 0;
+        masks_.table_ranks = 0;
+        masks_.atk_slots = 0;
+        masks_.def_slots = 0;
     }
 
-    auto GameImpl::RefillHands() -> void
+    auto GameImpl::AllAttacksCovered() const -> bool
     {
-        auto needs_cards = [&](PlyrIdxT const seat) { return hands_[seat].size() < cfg_.deal_up_to; };
-        auto draw_card = [&](PlyrIdxT const seat) -> bool
-        {
-            if (deck_.empty()) return false;
-            hands_[seat].push_back(std::move(deck_.back()));
-            deck_.pop_back();
-            return true;
-        };
+        return masks_.Uncovered() == 0;
+    }
 
-        bool was_drawn = true;
-        while (was_drawn)
-        {
-            was_drawn = false;
-            for (uint8_t offset = 0; offset < players_.size(); ++offset)
-            {
-                uint8_t const seat = (attacker_idx_ + offset) % players_.size();
-                if (needs_cards(seat)) was_drawn |= draw_card(seat);
-                if (deck_.empty()) break;
-            }
-        }
+    auto GameImpl::Step() -> MoveOutcome
+    {
+        auto const out = TryStep();
+        if (!out) error::raise(out.error());
+        return *out;
+    }
+
+    auto GameImpl::TryStep() -> error::Result<MoveOutcome>
+    {
+        DRK_CHECK(!players_.empty(), "Step() on a player-less game");
+        PlyrIdxT const actor = CurrentActor();
+
+        // std::shared_ptr<GameSnapshot const> snap{SnapshotFor(actor)};
+        // auto const deadline = std::chrono::steady_clock::now() + cfg_.turn_timeout;
+        //
+        // PlayerAction const action = players_[actor]->Play(std::move(snap), deadline);
+        auto const dec = judge_->GetAction(*this, actor);
+        if (!dec) return std::unexpected(dec.error());
+        return TryResolve(dec->action);
+    }
+
+    auto GameImpl::Resolve(PlayerAction const& action) -> MoveOutcome
+    {
+        auto const out = TryResolve(action);
+        if (!out) error::raise(out.error());
+        return *out;
     }
 
-    auto GameImpl::NextLivePlayer(PlyrIdxT const from) const -> PlyrIdxT
+    auto GameImpl::TryResolve(PlayerAction const& action) -> error::Result<MoveOutcome>
     {
-        PlyrIdxT i{from};
-        size_t const n = players_.size();
-        for (size_t j{}; j < n; ++j)
+        BeginResolve(action);
+
+        // Reporting is left to the host (see ViolationGate); nothing is formatted on this thread.
+        auto const plan = rules_->Validate(*this, action);
+        if (!plan.has_value())
         {
-            i = NextSeat(i);
-            if (!hands_[i].empty()) return i;
+            last_violation_ = plan.error();
+            return MoveOutcome::Invalid;
         }
-        DRK_THROW(durak::core::error::Code::State, "No live players");
+        DRK_TRY(rules_->Apply(*this, action, *plan));
+        return rules_->Advance(*this);
     }
 
-    auto GameImpl::AllAttacksCovered() const -> bool
+    auto GameImpl::Capture() const -> StateImage
     {
-        return std::ranges::none_of(table_,
-                                    [](TableSlot const& ts) { return ts.attack && !ts.defend; });
+        auto uid = [](CardSP const& c) -> uint8_t
+        {
+            return c ? static_cast<uint8_t>(util::CardToUID(*c)) : StateImage::NoCard;
+        };
+        auto uids = [&](std::vector<CardSP> const& v)
+        {
+            std::vector<uint8_t> out;
+            out.reserve(v.size());
+            for (CardSP const& c : v) out.push_back(uid(c));
+            return out;
+        };
+
+        StateImage img{};
+        img.hands.reserve(seats_);
+        for (size_t s = 0; s < seats_; ++s) img.hands.push_back(uids(hands_[s]));
+        for (size_t i = 0; i < table_.size(); ++i)
+        {
+            img.table_atk[i] = uid(table_[i].attack);
+            img.table_def[i] = uid(table_[i].defend);
+        }
+        img.deck = uids(deck_);
+        img.discard = uids(discard_);
+        img.trump = trump_;
+        img.attacker_idx = attacker_idx_;
+        img.defender_idx = defender_idx_;
+        img.phase = phase_;
+        img.defender_took = defender_took_;
+        img.bout_cap = bout_cap_;
+        return img;
     }
 
-    auto GameImpl::Step() -> MoveOutcome
+    auto GameImpl::Restore(StateImage const& img) -> void
     {
-        PlyrIdxT const actor = (phase_ == Phase::Defending) ? defender_idx_ : attacker_idx_;
+        DRK_ASSERT(img.hands.size() == seats_, "StateImage seat count mismatch");
 
-        // std::shared_ptr<GameSnapshot const> snap{SnapshotFor(actor)};
-        // auto const deadline = std::chrono::steady_clock::now() + cfg_.turn_timeout;
-        //
-        // PlayerAction const action = players_[actor]->Play(std::move(snap), deadline);
-        TimedDecision const dec = judge_->GetAction(*this, actor);
-        PlayerAction const action = dec.action;
+        auto card = [](uint8_t const id) -> CardSP
+        {
+            if (id == StateImage::NoCard) return {};
+            return std::make_shared<Card>(util::UIDToSuit(id), util::UIDToRank(id));
+        };
+        auto cards = [&](std::vector<uint8_t> const& ids, std::vector<CardSP>& out)
+        {
+            out.clear();
+            out.reserve(ids.size());
+            for (uint8_t const id : ids) out.push_back(card(id));
+        };
 
-        if (auto const ok = rules_->Validate(*this, action); !ok.has_value())
+        for (size_t s = 0; s < seats_; ++s) cards(img.hands[s], hands_[s]);
+        for (size_t i = 0; i < table_.size(); ++i)
         {
-            std::print("{}\n", durak::core::error::describe(ok.error()));
-            return MoveOutcome::Invalid;
+            table_[i].attack = card(img.table_atk[i]);
+            table_[i].defend = card(img.table_def[i]);
         }
-        rules_->Apply(*this, action);
-        return rules_->Advance(*this);;
+        cards(img.deck, deck_);
+        cards(img.discard, discard_);
+        trump_ = img.trump;
+        attacker_idx_ = img.attacker_idx;
+        defender_idx_ = img.defender_idx;
+        phase_ = img.phase;
+        defender_took_ = img.defender_took;
+        bout_cap_ = img.bout_cap;
+        RebuildMasks();
     }
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #define IDIOTGAME_GAME_HPP
 
 #include <algorithm>
+#include <bit>
 #include <random>
 #include <span>
 #include <string>
@@ -15,6 +16,9 @@
 #include "Rules.hpp"
 #include "Player.hpp"
 #include "Judge.hpp"
+#include "Exception.hpp"
+#include "Shape.hpp"
+#include "Util.hpp"
 
 namespace durak::core::debug
 {
@@ -23,6 +27,44 @@ namespace durak::core::debug
 
 namespace durak::core
 {
+    // Plain value copy of the authoritative state (cards as util::CardToUID ids).
+    // Used for checkpoints; independent of any CardSP identity.
+    struct StateImage
+    {
+        static constexpr uint8_t NoCard = 0xFF;
+
+        std::vector<std::vector<uint8_t>> hands;
+        std::array<uint8_t, constants::MaxTableSlots> table_atk{};
+        std::array<uint8_t, constants::MaxTableSlots> table_def{};
+        std::vector<uint8_t> deck;
+        std::vector<uint8_t> discard;
+        Suit trump{Suit::Spades};
+        uint8_t attacker_idx{0}, defender_idx{1};
+        Phase phase{Phase::Attacking};
+        bool defender_took{false};
+        uint8_t bout_cap{constants::MaxTableSlots};
+
+        auto operator==(StateImage const&) const -> bool = default;
+    };
+
+    // Bit-per-card (util::CardToUID) view of every zone, kept in step with the containers.
+    // The table summary makes every occupancy and rank question a bit test or popcount.
+    struct ZoneMasks
+    {
+        std::array<uint64_t, constants::MaxPlayers> hands{};
+        uint64_t deck{0};
+        uint64_t discard{0};
+        uint64_t table{0}; // attack and defend cards
+        uint8_t atk_slots{0}; // bit i = table_[i].attack present
+        uint8_t def_slots{0}; // bit i = table_[i].defend present
+        uint16_t table_ranks{0}; // bit r = some table card has rank r
+
+        auto Uncovered() const noexcept -> uint8_t { return static_cast<uint8_t>(atk_slots & ~def_slots); }
+        auto AttacksUsed() const noexcept -> size_t { return static_cast<size_t>(std::popcount(atk_slots)); }
+        auto UncoveredCount() const noexcept -> size_t { return static_cast<size_t>(std::popcount(Uncovered())); }
+        auto RankOnTable(Rank const r) const noexcept -> bool { return (table_ranks >> static_cast<unsigned>(r)) & 1u; }
+    };
+
     //forward declare
     class GameImpl
     {
@@ -31,62 +73,182 @@ namespace durak::core
         GameImpl(Config const& config,
                  std::unique_ptr<Rules> rules,
                  std::vector<std::unique_ptr<Player>> players);
+        // Player-less game (replay/analysis): only Resolve() may drive it, never Step().
+        GameImpl(Config const& config,
+                 std::unique_ptr<Rules> rules);
 
         // One state-machine step: ask current actor for an action, validate/apply/advance.
+        // Engine errors are raised (thrown, or abort without exceptions); TryStep returns them.
         auto Step() -> MoveOutcome;
+        auto TryStep() -> error::Result<MoveOutcome>;
+        // Validate/apply/advance an action for the current actor (no Judge, no players).
+        auto Resolve(PlayerAction const& action) -> MoveOutcome;
+        auto TryResolve(PlayerAction const& action) -> error::Result<MoveOutcome>;
+        auto CurrentActor() const noexcept -> PlyrIdxT
+        {
+            return (phase_ == Phase::Defending) ? defender_idx_ : attacker_idx_;
+        }
+
+        auto Capture() const -> StateImage;
+        auto Restore(StateImage const& img) -> void;
         auto SnapshotFor(uint8_t seat) const -> std::shared_ptr<GameSnapshot const>;
 
         auto Attacker() const noexcept -> PlyrIdxT { return attacker_idx_; }
         auto Defender() const noexcept -> PlyrIdxT { return defender_idx_; }
         auto PhaseNow() const noexcept -> Phase { return phase_; }
         auto Trump() const noexcept -> Suit { return trump_; }
-        auto PlayerCount() const noexcept -> size_t { return players_.size(); }
+        auto PlayerCount() const noexcept -> size_t { return seats_; }
+        auto Cfg() const noexcept -> Config const& { return cfg_; }
+        auto HandSize(PlyrIdxT const seat) const noexcept -> size_t { return hands_[seat].size(); }
+        auto DeckSize() const noexcept -> size_t { return deck_.size(); }
+        auto DiscardSize() const noexcept -> size_t { return discard_.size(); }
+        auto BoutCap() const noexcept -> uint8_t { return bout_cap_; }
+        auto Masks() const noexcept -> ZoneMasks const& { return masks_; }
+        // Card id (util::CardToUID) in a table slot, StateImage::NoCard when empty.
+        auto TableCard(uint8_t const slot, bool const defend) const noexcept -> uint8_t
+        {
+            CardSP const& c = defend ? table_[slot].defend : table_[slot].attack;
+            return c ? static_cast<uint8_t>(util::CardToUID(*c)) : StateImage::NoCard;
+        }
+
+        // Actor and action resolved by the most recent Step()/Resolve() (including Judge defaults on timeout).
+        auto LastActor() const noexcept -> PlyrIdxT { return last_actor_; }
+        auto LastAction() const noexcept -> PlayerAction const& { return last_action_; }
+        // Why the most recent Step()/Resolve() returned Invalid; empty after an accepted action.
+        auto LastViolation() const noexcept -> std::optional<error::RuleViolation> const& { return last_violation_; }
 
         //allows class to directly access private data on an instance
-        friend class ClassicRules;
+        template <class S>
+        friend struct BasicClassicPolicy;
         friend struct debug::Inspector;
         friend class Judge;
 
         //returns nullptr if doesnt exist
         auto FindFromHand(PlyrIdxT const seat, Card const& c) const -> CardWP;
+        //position of c in the seat's hand, empty if not held
+        auto HandIndexOf(PlyrIdxT const seat, Card const& c) const -> std::optional<uint8_t>;
         auto FindFromAtkTable(Card const& c) const -> CardWP;
 
         //Handles both moving cards to attk and defend, will treat intent as move to atk
-        //if def is null. Throws if invariants break.
-        auto MoveHandToTable(PlyrIdxT const seat, CardWP const& atk, CardWP const& def = {}) -> void;
+        //if def is null. Returns an error if invariants break.
+        auto MoveHandToTable(PlyrIdxT const seat, CardWP const& atk, CardWP const& def = {}) -> error::Result<>;
+        // Planned move (see ActionPlan): hand position to table slot, no searching or checks.
+        auto PlaceFromHand(PlyrIdxT const seat, uint8_t const hand_idx, uint8_t const slot, bool const defend) -> void
+        {
+            std::vector<CardSP>& hand = hands_[seat];
+            CardSP& card = hand[hand_idx];
+            uint64_t const bit = uint64_t{1} << util::CardToUID(*card);
+            masks_.hands[seat] &= ~bit;
+            masks_.table |= bit;
+            masks_.table_ranks |= static_cast<uint16_t>(1u << static_cast<unsigned>(card->rank));
+            if (defend)
+            {
+                masks_.def_slots |= static_cast<uint8_t>(1u << slot);
+                table_[slot].defend = std::move(card);
+            }
+            else
+            {
+                masks_.atk_slots |= static_cast<uint8_t>(1u << slot);
+                table_[slot].attack = std::move(card);
+            }
+            hand.erase(hand.begin() + hand_idx);
+        }
+
         auto ClearTable() -> void;
         auto MoveTableToDefenderHand() -> void;
         //Uses the specific order for Durak
-        auto RefillHands() -> void;
+        template <class S = DynamicShape>
+        auto RefillHands() -> void
+        {
+            size_t const n = S::Seats(seats_);
+            auto draw_card = [&](PlyrIdxT const seat) -> bool
+            {
+                if (deck_.empty()) return false;
+                uint64_t const bit = uint64_t{1} << util::CardToUID(*deck_.back());
+                masks_.deck &= ~bit;
+                masks_.hands[seat] |= bit;
+                hands_[seat].push_back(std::move(deck_.back()));
+                deck_.pop_back();
+                return true;
+            };
 
-        auto NextLivePlayer(PlyrIdxT from) const -> PlyrIdxT;
+            bool was_drawn = true;
+            while (was_drawn)
+            {
+                was_drawn = false;
+                for (uint8_t offset = 0; offset < n; ++offset)
+                {
+                    auto const seat = static_cast<PlyrIdxT>((attacker_idx_ + offset) % n);
+                    if (hands_[seat].size() < cfg_.deal_up_to) was_drawn |= draw_card(seat);
+                    if (deck_.empty()) break;
+                }
+            }
+        }
+
+        template <class S = DynamicShape>
+        auto NextLivePlayer(PlyrIdxT const from) const -> error::Result<PlyrIdxT>
+        {
+            PlyrIdxT i{from};
+            for (size_t j{}; j < S::Seats(seats_); ++j)
+            {
+                i = NextSeat<S>(i);
+                if (!hands_[i].empty()) return i;
+            }
+            DRK_FAIL(durak::core::error::Code::State, "No live players");
+        }
 
-        inline auto NextSeat(PlyrIdxT const idx) const -> PlyrIdxT
+        template <class S = DynamicShape>
+        auto NextSeat(PlyrIdxT const idx) const -> PlyrIdxT
         {
-            return static_cast<PlyrIdxT>((idx + 1) % players_.size());
+            return static_cast<PlyrIdxT>((idx + 1) % S::Seats(seats_));
         }
 
         auto AllAttacksCovered() const -> bool;
         auto PlayerAt(PlyrIdxT seat) -> Player* { return players_[seat].get(); }
 
+    protected:
+        // TryResolve with the rules known at compile time (see BasicGame).
+        template <class P>
+        auto ResolveWith(PlayerAction const& action) -> error::Result<MoveOutcome>
+        {
+            BeginResolve(action);
+            auto const plan = P::Validate(*this, action);
+            if (!plan.has_value())
+            {
+                last_violation_ = plan.error();
+                return MoveOutcome::Invalid;
+            }
+            DRK_TRY(P::Apply(*this, action, *plan));
+            return P::Advance(*this);
+        }
+
     private:
+        auto BeginResolve(PlayerAction const& action) -> void
+        {
+            last_actor_ = CurrentActor();
+            last_action_ = action;
+            last_violation_.reset();
+        }
+
         //Produces a shuffled deck
         auto BuildDeck() -> void;
         auto DealInitalHands() -> void;
         auto ChoseInitalRoles() -> void;
+        auto RebuildMasks() -> void;
 
     private:
         Config cfg_;
         std::unique_ptr<Rules> rules_;
         std::vector<std::unique_ptr<Player>> players_;
-        std::mt19937_64 rng_;
         std::shared_ptr<Judge> judge_;
 
         // Authoritative state
-        std::vector<std::vector<CardSP>> hands_; // [seat] owns cards in hand
+        uint8_t seats_{0};
+        std::array<std::vector<CardSP>, constants::MaxPlayers> hands_{}; // [seat] owns cards in hand, seats_ used
         std::array<TableSlot, constants::MaxTableSlots> table_{}; // owns table cards
         std::vector<CardSP> deck_; // owns remaining deck cards
         std::vector<CardSP> discard_; // beaten cards
+        ZoneMasks masks_{}; // shadow of the zones above
 
         // Turn/round state
         Suit trump_{Suit::Spades};
@@ -94,6 +256,11 @@ namespace durak::core
         Phase phase_{Phase::Attacking};
         bool defender_took_{false}; // set by Apply(Take)
         uint8_t bout_cap_{constants::MaxTableSlots};
+
+        // Last resolved decision (for recorders)
+        PlyrIdxT last_actor_{0};
+        PlayerAction last_action_{PassAction{}};
+        std::optional<error::RuleViolation> last_violation_{};
     };
 }
 #endif //IDIOTGAME_GAME_HPP
\ No newline at end of file
@@ -0,0 +1,124 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_INLINEVEC_HPP
+#define IDIOTGAME_INLINEVEC_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace durak::core
+{
+    // Vector with its storage inline: at most N elements, never allocates. Only live elements are
+    // constructed. Overflow is a programming error and aborts; callers bound external input first.
+    template <class T, std::size_t N>
+    class InlineVec
+    {
+        static_assert(N > 0 && N <= 255, "InlineVec keeps its size in a byte");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = T&;
+        using const_reference = T const&;
+        using iterator = T*;
+        using const_iterator = T const*;
+
+        InlineVec() noexcept = default;
+
+        InlineVec(std::initializer_list<T> const init)
+        {
+            for (T const& v : init) push_back(v);
+        }
+
+        InlineVec(InlineVec const& o)
+        {
+            for (T const& v : o) push_back(v);
+        }
+
+        InlineVec(InlineVec&& o) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            for (T& v : o) push_back(std::move(v));
+            o.clear();
+        }
+
+        auto operator=(InlineVec const& o) -> InlineVec&
+        {
+            if (this != &o)
+            {
+                clear();
+                for (T const& v : o) push_back(v);
+            }
+            return *this;
+        }
+
+        auto operator=(InlineVec&& o) noexcept(std::is_nothrow_move_constructible_v<T>) -> InlineVec&
+        {
+            if (this != &o)
+            {
+                clear();
+                for (T& v : o) push_back(std::move(v));
+                o.clear();
+            }
+            return *this;
+        }
+
+        ~InlineVec() { clear(); }
+
+        static constexpr auto capacity() noexcept -> size_type { return N; }
+        auto size() const noexcept -> size_type { return size_; }
+        auto empty() const noexcept -> bool { return size_ == 0; }
+        auto full() const noexcept -> bool { return size_ == N; }
+
+        auto data() noexcept -> T* { return std::launder(reinterpret_cast<T*>(storage_)); }
+        auto data() const noexcept -> T const* { return std::launder(reinterpret_cast<T const*>(storage_)); }
+
+        auto begin() noexcept -> iterator { return data(); }
+        auto end() noexcept -> iterator { return data() + size_; }
+        auto begin() const noexcept -> const_iterator { return data(); }
+        auto end() const noexcept -> const_iterator { return data() + size_; }
+
+        auto operator[](size_type const i) noexcept -> reference { return data()[i]; }
+        auto operator[](size_type const i) const noexcept -> const_reference { return data()[i]; }
+        auto front() noexcept -> reference { return data()[0]; }
+        auto front() const noexcept -> const_reference { return data()[0]; }
+        auto back() noexcept -> reference { return data()[size_ - 1]; }
+        auto back() const noexcept -> const_reference { return data()[size_ - 1]; }
+
+        template <class... Args>
+        auto emplace_back(Args&&... args) -> reference
+        {
+            if (size_ == N) [[unlikely]] std::abort();
+            T* const p = std::construct_at(data() + size_, std::forward<Args>(args)...);
+            ++size_;
+            return *p;
+        }
+
+        auto push_back(T const& v) -> void { emplace_back(v); }
+        auto push_back(T&& v) -> void { emplace_back(std::move(v)); }
+
+        auto pop_back() noexcept -> void
+        {
+            --size_;
+            std::destroy_at(data() + size_);
+        }
+
+        auto clear() noexcept -> void
+        {
+            std::destroy(begin(), end());
+            size_ = 0;
+        }
+
+    private:
+        alignas(T) std::byte storage_[sizeof(T) * N];
+        unsigned char size_{0};
+    };
+}
+
+#endif //IDIOTGAME_INLINEVEC_HPP
@@ -0,0 +1,414 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "IsmctsAi.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "CardMasks.hpp"
+#include "ClassicPolicy.hpp"
+#include "CompactMove.hpp"
+#include "EndgameSolver.hpp"
+#include "Game.hpp"
+#include "Util.hpp"
+
+namespace durak::core
+{
+    namespace
+    {
+        constexpr uint8_t NoCard = StateImage::NoCard;
+
+        // Caps the cover search when the hand almost, but not quite, covers the table.
+        constexpr size_t CoverSearchBudget = 4096;
+
+        auto RankOf(uint8_t const id) -> uint8_t { return std::to_underlying(util::UIDToRank(id)); }
+
+        // Lower is cheaper to give away: trumps rank above every plain card.
+        auto CostOf(uint8_t const id, Suit const trump) -> int
+        {
+            return RankOf(id) + (util::UIDToSuit(id) == trump ? 13 : 0);
+        }
+
+        struct CoverSearch
+        {
+            std::span<uint8_t const> attacks; // most constrained first
+            std::span<uint8_t const> hand; // cheapest first
+            Suit trump;
+            size_t cap;
+            size_t budget{CoverSearchBudget};
+            CompactMove cur{CompactMove::Defend};
+
+            auto Run(size_t const i, uint64_t const used, std::vector<CompactMove>& out) -> void
+            {
+                if (i == attacks.size())
+                {
+                    out.push_back(cur);
+                    return;
+                }
+                for (size_t j = 0; j < hand.size() && out.size() < cap && budget != 0; ++j)
+                {
+                    --budget;
+                    if ((used >> j) & 1u || !masks::Beats(hand[j], attacks[i], trump)) continue;
+                    cur.cards[2 * i] = attacks[i];
+                    cur.cards[2 * i + 1] = hand[j];
+                    Run(i + 1, used | (uint64_t{1} << j), out);
+                }
+            }
+        };
+
+        // Moves the current actor may make in 'g', in the abstraction the tree uses.
+        // Read straight off the zone masks: no StateImage per ply.
+        auto GenMoves(GameImpl const& g, uint8_t const defend_options, std::vector<CompactMove>& out) -> void
+        {
+            out.clear();
+            ZoneMasks const& zm = g.Masks();
+            size_t const used = zm.AttacksUsed();
+
+            if (g.PhaseNow() == Phase::Attacking)
+            {
+                size_t const cap = (used == 0)
+                                       ? std::min(constants::MaxTableSlots, g.HandSize(g.Defender()))
+                                       : g.BoutCap();
+                if (used < cap)
+                {
+                    uint64_t const playable =
+                        (used == 0) ? ~uint64_t{0} : masks::CardsOfRanks(masks::RanksOf(zm.table));
+                    for (uint64_t m = zm.hands[g.Attacker()] & playable; m; m &= m - 1)
+                    {
+                        out.push_back(CompactMove{CompactMove::Attack, 1, {static_cast<uint8_t>(std::countr_zero(m))}});
+                    }
+                }
+                if (used != 0) out.push_back(CompactMove{CompactMove::Pass});
+                return;
+            }
+
+            if (g.PhaseNow() != Phase::Defending) return;
+            out.push_back(CompactMove{CompactMove::Take});
+
+            std::array<uint8_t, constants::MaxTableSlots> atk{};
+            size_t u = 0;
+            for (uint8_t slots = zm.Uncovered(); slots; slots &= static_cast<uint8_t>(slots - 1))
+            {
+                atk[u++] = g.TableCard(static_cast<uint8_t>(std::countr_zero(slots)), false);
+            }
+
+            uint64_t const hand_mask = zm.hands[g.Defender()];
+            std::array<uint8_t, constants::MaxDeckSize> hand_buf{};
+            size_t h = 0;
+            for (uint64_t m = hand_mask; m; m &= m - 1) hand_buf[h++] = static_cast<uint8_t>(std::countr_zero(m));
+            if (u == 0 || u > h) return;
+            std::span<uint8_t> const hand{hand_buf.data(), h};
+            Suit const trump = g.Trump();
+            std::ranges::sort(hand, {}, [&](uint8_t id) { return CostOf(id, trump); });
+
+            auto beaters = [&](uint8_t a) { return std::popcount(masks::Beaters(a, trump) & hand_mask); };
+            std::sort(atk.begin(), atk.begin() + u, [&](uint8_t l, uint8_t r) { return beaters(l) < beaters(r); });
+            if (beaters(atk[0]) == 0) return;
+
+            CoverSearch search{
+                .attacks = std::span{atk.data(), u},
+                .hand = hand,
+                .trump = trump,
+                .cap = out.size() + defend_options
+            };
+            search.cur.n = static_cast<uint8_t>(u);
+            search.Run(0, 0, out);
+        }
+
+        template <class G>
+        auto Apply(G& g, CompactMove const& m) -> MoveOutcome
+        {
+            auto const out = g.TryResolve(ToAction(g, g.CurrentActor(), m));
+            // An engine error or a rejected move ends the playout; it is scored like a cut-off rollout.
+            return out.has_value() ? *out : MoveOutcome::Invalid;
+        }
+
+        // 1 for every seat that got rid of its cards, 0 for the fool. Cut-off playouts blame the biggest hand.
+        auto Score(GameImpl const& g) -> std::array<double, constants::MaxPlayers>
+        {
+            std::array<double, constants::MaxPlayers> r{};
+            size_t biggest = 0;
+            for (PlyrIdxT s = 0; s < g.PlayerCount(); ++s) biggest = std::max(biggest, g.HandSize(s));
+            for (PlyrIdxT s = 0; s < g.PlayerCount(); ++s)
+            {
+                r[s] = (biggest == 0) ? 0.5 : (g.HandSize(s) < biggest ? 1.0 : 0.0);
+            }
+            return r;
+        }
+
+        // Maps a move's uids back onto the snapshot's cards.
+        auto ToSnapshotAction(GameSnapshot const& s, CompactMove const& m) -> PlayerAction
+        {
+            auto hand_card = [&](uint8_t const id) -> CardWP
+            {
+                auto const it = std::ranges::find_if(s.my_hand, [&](CardWP const& w)
+                {
+                    CardSP const c = w.lock();
+                    return c && util::CardToUID(*c) == id;
+                });
+                return it != s.my_hand.end() ? *it : CardWP{};
+            };
+            auto table_card = [&](uint8_t const id) -> CardWP
+            {
+                for (TableSlotView const& ts : s.table)
+                {
+                    CardSP const a = ts.attack.lock();
+                    if (a && util::CardToUID(*a) == id) return ts.attack;
+                }
+                return {};
+            };
+
+            switch (m.kind)
+            {
+            case CompactMove::Attack:
+                return AttackAction{{hand_card(m.cards[0])}};
+            case CompactMove::Defend:
+                {
+                    DefendAction d{};
+                    for (size_t i = 0; i < m.n; ++i)
+                    {
+                        d.pairs.push_back(DefendPair{table_card(m.cards[2 * i]), hand_card(m.cards[2 * i + 1])});
+                    }
+                    return d;
+                }
+            case CompactMove::Take:
+                return TakeAction{};
+            default:
+                return PassAction{};
+            }
+        }
+
+        struct Node
+        {
+            CompactMove move{};
+            PlyrIdxT mover{};
+            Node* parent{};
+            std::vector<std::unique_ptr<Node>> children;
+            uint32_t visits{0};
+            uint32_t avail{0};
+            double reward{0.0}; // summed from the mover's point of view
+        };
+    }
+
+    IsmctsAI::IsmctsAI(uint64_t rng_seed, IsmctsConfig cfg) :
+        cfg_(cfg),
+        seed_(rng_seed),
+        fallback_(rng_seed)
+    {
+    }
+
+    auto IsmctsAI::CanDeterminize(GameSnapshot const& s) -> bool
+    {
+        PlyrIdxT const me = (s.phase == Phase::Defending) ? s.defender_idx : s.attacker_idx;
+        size_t hidden = s.deck_count;
+        for (PlyrIdxT seat = 0; seat < s.other_counts.size(); ++seat)
+        {
+            if (seat != me) hidden += s.other_counts[seat];
+        }
+        return s.deal_up_to != 0 && s.other_counts.size() == s.n_players &&
+            s.n_players >= 2 && s.n_players <= constants::MaxPlayers &&
+            static_cast<size_t>(std::popcount(s.unseen_mask)) == hidden;
+    }
+
+    auto IsmctsAI::Play(std::shared_ptr<const GameSnapshot> snapshot, std::chrono::steady_clock::time_point deadline)
+        -> PlayerAction
+    {
+        GameSnapshot const& s = *snapshot;
+        PlyrIdxT const me = (s.phase == Phase::Defending) ? s.defender_idx : s.attacker_idx;
+        last_iterations_ = 0;
+
+        // Public part of every determinization
+        StateImage base{};
+        base.hands.resize(s.n_players);
+        for (CardWP const& w : s.my_hand)
+        {
+            if (CardSP const c = w.lock()) base.hands[me].push_back(static_cast<uint8_t>(util::CardToUID(*c)));
+        }
+        for (size_t i = 0; i < constants::MaxTableSlots; ++i)
+        {
+            if (CardSP const a = s.table[i].attack.lock()) base.table_atk[i] = static_cast<uint8_t>(util::CardToUID(*a));
+            else base.table_atk[i] = NoCard;
+            if (CardSP const d = s.table[i].defend.lock()) base.table_def[i] = static_cast<uint8_t>(util::CardToUID(*d));
+            else base.table_def[i] = NoCard;
+        }
+        base.trump = s.trump;
+        base.attacker_idx = s.attacker_idx;
+        base.defender_idx = s.defender_idx;
+        base.phase = s.phase;
+        base.defender_took = s.defender_took;
+        base.bout_cap = s.bout_cap;
+
+        if (!CanDeterminize(s))
+        {
+            return fallback_.Play(std::move(snapshot), deadline);
+        }
+
+        belief_.Observe(s, me);
+        BeliefState const& belief = belief_;
+
+        auto const stop = deadline - cfg_.safety;
+
+        // Heads-up with an empty deck the unseen cards are exactly the opponent's hand: solve it outright
+        if (cfg_.endgame_share > 0.0 && s.n_players == 2 && s.deck_count == 0)
+        {
+            StateImage img = base;
+            for (uint64_t m = s.unseen_mask; m; m &= m - 1)
+            {
+                img.hands[1 - me].push_back(static_cast<uint8_t>(std::countr_zero(m)));
+            }
+            if (auto const pos = EndgamePosition::From(img))
+            {
+                auto const now = std::chrono::steady_clock::now();
+                auto const budget = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    (stop - now) * cfg_.endgame_share);
+                auto const r = endgame_.Solve(*pos, now + budget);
+                if (r && r->solved) return ToSnapshotAction(s, r->move);
+            }
+        }
+        // The deck dealt from: a 52-card game shows a card below Six somewhere this seat can place it.
+        // (If every one of those is already discarded, either deck plays the same from here.)
+        uint64_t known = s.unseen_mask;
+        for (auto const& ids : base.hands) for (uint8_t const id : ids) known |= masks::CardBit(id);
+        for (size_t i = 0; i < constants::MaxTableSlots; ++i)
+        {
+            if (base.table_atk[i] != NoCard) known |= masks::CardBit(base.table_atk[i]);
+            if (base.table_def[i] != NoCard) known |= masks::CardBit(base.table_def[i]);
+        }
+        bool const deck36 = (known & ~DeckMask<true>) == 0;
+
+        uint64_t const call = calls_.fetch_add(1);
+        unsigned const threads = cfg_.threads != 0 ? cfg_.threads : std::max(1u, std::thread::hardware_concurrency());
+
+        Node root{};
+        root.mover = me;
+        std::mutex tree_mx;
+        std::atomic<uint32_t> started{0};
+        std::atomic<uint32_t> done{0};
+
+        auto worker = [&](unsigned const t)
+        {
+            std::mt19937_64 rng{seed_ ^ (call << 20) ^ (uint64_t{t} * 0x9E3779B97F4A7C15ull)};
+            Config gc{};
+            gc.n_players = s.n_players;
+            gc.deal_up_to = s.deal_up_to;
+            gc.deck36 = deck36;
+            gc.seed = rng();
+            // Every iteration Restores a determinization, so the shape only needs the seat count
+            DispatchSeats(gc.n_players, [&]<class S>(S)
+            {
+                BasicClassicGame<S> g(gc);
+
+                std::vector<CompactMove> moves;
+                std::vector<CompactMove const*> untried;
+                StateImage img = base;
+
+                while (std::chrono::steady_clock::now() < stop)
+                {
+                    if (cfg_.max_iterations != 0 && started.fetch_add(1) >= cfg_.max_iterations) break;
+
+                    // Determinize: known cards stay with their owners, the rest is dealt at random
+                    belief.Sample(rng, img);
+                    g.Restore(img);
+
+                    MoveOutcome out = MoveOutcome::Applied;
+                    Node* node = &root;
+                    {
+                        std::lock_guard lock(tree_mx);
+                        ++node->visits; // visits land before rewards: a virtual loss that spreads the threads
+                    }
+                    // The lock covers only the statistics: moves are generated and applied outside it
+                    while (out != MoveOutcome::GameEnded && out != MoveOutcome::Invalid)
+                    {
+                        GenMoves(g, cfg_.defend_options, moves);
+                        if (moves.empty()) break;
+
+                        bool expanded = false;
+                        {
+                            std::lock_guard lock(tree_mx);
+                            untried.clear();
+                            Node* best = nullptr;
+                            double best_ucb = -1.0;
+                            for (CompactMove const& m : moves)
+                            {
+                                auto const it = std::ranges::find_if(node->children,
+                                                                     [&](auto const& c) { return c->move == m; });
+                                if (it == node->children.end())
+                                {
+                                    untried.push_back(&m);
+                                    continue;
+                                }
+                                Node* c = it->get();
+                                ++c->avail;
+                                double const ucb = c->reward / c->visits +
+                                    cfg_.exploration * std::sqrt(std::log(static_cast<double>(c->avail)) / c->visits);
+                                if (ucb > best_ucb)
+                                {
+                                    best_ucb = ucb;
+                                    best = c;
+                                }
+                            }
+
+                            if (!untried.empty())
+                            {
+                                std::uniform_int_distribution<size_t> pick{0, untried.size() - 1};
+                                auto child = std::make_unique<Node>();
+                                child->move = *untried[pick(rng)];
+                                child->mover = g.CurrentActor();
+                                child->parent = node;
+                                child->avail = 1;
+                                best = node->children.emplace_back(std::move(child)).get();
+                                expanded = true;
+                            }
+                            node = best;
+                            ++node->visits;
+                        }
+
+                        out = Apply(g, node->move); // node->move is fixed once the child exists
+                        if (expanded) break;
+                    }
+
+                    // Rollout without the lock
+                    for (uint16_t ply = 0; ply < cfg_.rollout_cap && out != MoveOutcome::GameEnded &&
+                         out != MoveOutcome::Invalid; ++ply)
+                    {
+                        GenMoves(g, cfg_.defend_options, moves);
+                        if (moves.empty()) break;
+                        out = Apply(g, moves[std::uniform_int_distribution<size_t>{0, moves.size() - 1}(rng)]);
+                    }
+
+                    auto const reward = Score(g);
+                    {
+                        std::lock_guard lock(tree_mx);
+                        for (Node* p = node; p->parent != nullptr; p = p->parent) p->reward += reward[p->mover];
+                    }
+                    done.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        };
+
+        {
+            std::vector<std::jthread> helpers;
+            helpers.reserve(threads - 1);
+            for (unsigned t = 1; t < threads; ++t) helpers.emplace_back(worker, t);
+            worker(0);
+        }
+        last_iterations_ = done.load();
+
+        auto const best = std::ranges::max_element(root.children, {}, [](auto const& c) { return c->visits; });
+        if (best == root.children.end())
+        {
+            return fallback_.Play(std::move(snapshot), deadline);
+        }
+
+        return ToSnapshotAction(s, (*best)->move);
+    }
+}
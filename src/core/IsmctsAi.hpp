@@ -0,0 +1,65 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_ISMCTSAI_HPP
+#define IDIOTGAME_ISMCTSAI_HPP
+
+#include <atomic>
+#include <chrono>
+
+#include "BeliefState.hpp"
+#include "EndgameSolver.hpp"
+#include "Player.hpp"
+#include "RandomAi.hpp"
+#include "State.hpp"
+#include "Types.hpp"
+
+namespace durak::core
+{
+    struct IsmctsConfig
+    {
+        unsigned threads{0}; // 0 = std::thread::hardware_concurrency()
+        uint32_t max_iterations{0}; // 0 = until the deadline
+        double exploration{0.7}; // UCB1 constant
+        std::chrono::milliseconds safety{5}; // stop this long before the deadline
+        uint16_t rollout_cap{400}; // plies before a rollout is scored by hand sizes
+        uint8_t defend_options{12}; // full covers tried per defence (plus Take)
+        double endgame_share{0.5}; // heads-up empty-deck budget given to EndgameSolver first; 0 disables
+    };
+
+    // Single-observer information-set MCTS. Every iteration deals the unseen cards from a BeliefState
+    // (consistent with other_counts, deck_count and cards seen picked up), walks one tree shared by
+    // all worker threads over the moves legal in that deal, and finishes with a random rollout.
+    // The tree lock covers only node statistics; move generation and simulation run unlocked.
+    // Attacks are single cards; defences are a bounded set of full covers plus Take.
+    // Once a heads-up deck runs dry nothing is hidden, and a solved EndgameSolver result is played instead.
+    class IsmctsAI final : public Player
+    {
+    public:
+        explicit IsmctsAI(uint64_t rng_seed, IsmctsConfig cfg = {});
+
+        // Searches until 'deadline - safety' (or max_iterations) and returns the most visited move.
+        // Falls back to RandomAI when !CanDeterminize(snapshot).
+        auto Play(std::shared_ptr<const GameSnapshot> snapshot,
+                  std::chrono::steady_clock::time_point deadline) -> PlayerAction override;
+
+        // True if the snapshot carries the public counts (deck_count, deal_up_to, unseen_mask, other_counts)
+        // that a determinization needs and they agree with each other.
+        static auto CanDeterminize(GameSnapshot const& s) -> bool;
+
+        // Iterations completed by the last Play() across all threads.
+        auto LastIterations() const noexcept -> uint32_t { return last_iterations_.load(); }
+
+    private:
+        IsmctsConfig cfg_;
+        uint64_t seed_;
+        std::atomic<uint64_t> calls_{0};
+        std::atomic<uint32_t> last_iterations_{0};
+        RandomAI fallback_;
+        BeliefState belief_; // carried across calls within a game
+        EndgameSolver endgame_{16}; // table reused across calls
+    };
+}
+
+#endif //IDIOTGAME_ISMCTSAI_HPP
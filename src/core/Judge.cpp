@@ -20,10 +20,10 @@ namespace durak::core
         });
     }
 
-    static auto MakeDefaultAttack(GameSnapshot const& s) -> PlayerAction
+    static auto MakeDefaultAttack(GameSnapshot const& s) -> error::Result<PlayerAction>
     {
         if (s.my_hand.empty())
-            return PassAction{};
+            return PlayerAction{PassAction{}};
 
         //looks for smallest card
         CardWP best{};
@@ -52,12 +52,12 @@ namespace durak::core
         }
         if (!best_sp) [[unlikely]]
         {
-            DRK_THROW(durak::core::error::Code::State, "Best did not exist at return time");
+            DRK_FAIL(durak::core::error::Code::State, "Best did not exist at return time");
         };
-        return AttackAction{std::vector<CardWP>{best}};
+        return PlayerAction{AttackAction{{best}}};
     }
 
-    auto Judge::GetAction(GameImpl& game, PlyrIdxT actor) const -> TimedDecision
+    auto Judge::GetAction(GameImpl& game, PlyrIdxT actor) const -> error::Result<TimedDecision>
     {
         std::shared_ptr<const GameSnapshot> snap = game.SnapshotFor(actor);
         auto const deadline = std::chrono::steady_clock::now() + game.cfg_.turn_timeout;
@@ -79,21 +79,27 @@ namespace durak::core
 
         if (fut.wait_until(deadline) == std::future_status::ready)
         {
-            return {fut.get(), DesicionResult::OK};
+            return TimedDecision{fut.get(), DesicionResult::OK};
         }
 
         //Timeout
-        TimedDecision res{};
-        res.result = DesicionResult::Timeout;
+        auto const fallback = DefaultAction(game, actor);
+        if (!fallback) return std::unexpected(fallback.error());
+        return TimedDecision{*fallback, DesicionResult::Timeout};
+    }
+
+    auto Judge::DefaultAction(GameImpl const& game, PlyrIdxT actor) -> error::Result<PlayerAction>
+    {
         std::shared_ptr<const GameSnapshot> s_now = game.SnapshotFor(actor);
         if (s_now->phase == Phase::Defending)
         {
-            res.action = TakeAction{};
-            return res;
+            return PlayerAction{TakeAction{}};
         }
 
-        bool const table_has_attacks = TableHasAnyAttack(*s_now);
-        res.action = table_has_attacks ? PlayerAction{PassAction{}} : MakeDefaultAttack(*s_now);
-        return res;
+        if (TableHasAnyAttack(*s_now))
+        {
+            return PlayerAction{PassAction{}};
+        }
+        return MakeDefaultAttack(*s_now);
     }
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "Actions.hpp"
 #include "State.hpp"
 #include "Types.hpp"
+#include "Exception.hpp"
 
 namespace durak::core
 {
@@ -30,7 +31,9 @@ namespace durak::core
     public:
         Judge() = default;
 
-        auto GetAction(GameImpl& game, PlyrIdxT actor) const -> TimedDecision;
+        auto GetAction(GameImpl& game, PlyrIdxT actor) const -> error::Result<TimedDecision>;
+        // Action substituted when the actor times out or runs out of retries: Take, Pass, or lowest card.
+        static auto DefaultAction(GameImpl const& game, PlyrIdxT actor) -> error::Result<PlayerAction>;
     };
 }
 #endif //IDIOTGAME_JUDGE_HPP
\ No newline at end of file
@@ -4,12 +4,40 @@
 
 #ifndef IDIOTGAME_OMEGAEXCEPTION_HPP
 #define IDIOTGAME_OMEGAEXCEPTION_HPP
+#include <atomic>
+#include <cstddef>
 #include <source_location>
 #include <stacktrace>
+#include <string>
 #include "Types.hpp"
 
 namespace durak::core
 {
+    // How much of the call stack an OmegaException records.
+    enum class StackCapture : uint8_t
+    {
+        Off, // nothing: cheapest, for hot paths under error storms
+        Lazy, // raw frame addresses (bounded depth), symbolized only in to_str()
+        Full // full depth, symbolized eagerly at construction
+    };
+
+    inline constexpr std::size_t LazyStackDepth = 16;
+
+    namespace detail
+    {
+        inline std::atomic<StackCapture> g_stack_capture{StackCapture::Lazy};
+    }
+
+    inline auto SetStackCapture(StackCapture const mode) noexcept -> void
+    {
+        detail::g_stack_capture.store(mode, std::memory_order_relaxed);
+    }
+
+    inline auto GetStackCapture() noexcept -> StackCapture
+    {
+        return detail::g_stack_capture.load(std::memory_order_relaxed);
+    }
+
     //inspired by CPPCon2023 "Exceptionally bad" by Peter Muldoon
     template <typename T>
     class OmegaException
@@ -18,12 +46,25 @@ namespace durak::core
         OmegaException(std::string err_str,
                        T usr_data,
                        std::source_location const& src_loc = std::source_location::current(),
-                       std::stacktrace backtrace = std::stacktrace::current()) :
+                       StackCapture const capture = GetStackCapture()) :
             err_str_{std::move(err_str)},
             usr_data_{std::move(usr_data)},
-            src_loc_{src_loc},
-            backtrace_{backtrace}
+            src_loc_{src_loc}
         {
+            switch (capture)
+            {
+            case StackCapture::Off:
+                break;
+            case StackCapture::Lazy:
+                backtrace_ = std::stacktrace::current(1, LazyStackDepth);
+                whole_ = backtrace_.size() < LazyStackDepth;
+                break;
+            case StackCapture::Full:
+                backtrace_ = std::stacktrace::current(1);
+                whole_ = true;
+                symbolized_ = Symbolize(backtrace_, whole_);
+                break;
+            }
         }
 
         [[nodiscard]]
@@ -35,6 +76,7 @@ namespace durak::core
         [[nodiscard]]
         auto where() const noexcept -> std::source_location const& { return src_loc_; }
 
+        // Empty when capture was Off (or rate limited).
         [[nodiscard]]
         auto stack() const noexcept -> std::stacktrace const& { return backtrace_; }
 
@@ -46,18 +88,30 @@ namespace durak::core
         {
             std::string s = std::format("{}({}:{}), function `{}`\n", src_loc_.file_name(), src_loc_.line(),
                                         src_loc_.column(), src_loc_.function_name());
-            for (auto it = backtrace_.begin(); it != (backtrace_.end() - 3); ++it)
+            s += symbolized_.empty() ? Symbolize(backtrace_, whole_) : symbolized_;
+            return s;
+        }
+
+    private:
+        // 'whole': the capture reached the bottom of the stack, so its last frames are the runtime's
+        // own (start/main wrappers) and are dropped. A depth-limited capture keeps every frame.
+        static auto Symbolize(std::stacktrace const& st, bool const whole) -> std::string
+        {
+            std::size_t const n = (whole && st.size() > 3) ? st.size() - 3 : st.size();
+            std::string s;
+            for (auto it = st.begin(); it != st.begin() + static_cast<std::ptrdiff_t>(n); ++it)
             {
                 s += std::format("{}({}):{}\n", it->source_file(), it->source_line(), it->description());
             }
             return s;
         }
 
-    private:
         std::string err_str_;
         T usr_data_;
         std::source_location const src_loc_;
-        std::stacktrace backtrace_;
+        std::stacktrace backtrace_{};
+        std::string symbolized_{};
+        bool whole_{false};
     };
 }
 
@@ -3,6 +3,7 @@
 //
 
 #include "RandomAi.hpp"
+#include "CardMasks.hpp"
 #include "Util.hpp"
 
 #include <bit>
@@ -13,15 +14,17 @@
 
 namespace durak::core
 {
-    RandomAI::RandomAI(uint64_t rng_seed) :
+    template <class Rng>
+    BasicRandomAI<Rng>::BasicRandomAI(uint64_t rng_seed) :
         rng_(rng_seed)
     {
     }
 
     using namespace durak::core;
 
-    auto RandomAI::Play(std::shared_ptr<const GameSnapshot> snapshot, std::chrono::steady_clock::time_point deadline)
-        -> durak::core::PlayerAction
+    template <class Rng>
+    auto BasicRandomAI<Rng>::Play(std::shared_ptr<const GameSnapshot> snapshot,
+                                  std::chrono::steady_clock::time_point deadline) -> durak::core::PlayerAction
     {
         (void)deadline;
 
@@ -36,24 +39,15 @@ namespace durak::core
         return PassAction{};
     }
 
-    static inline auto Beats(Card const& d, Card const& a, Suit const trump) -> bool
-    {
-        return ClassicRules::Beats(d, a, trump);
-    }
-
-    auto RandomAI::AttackMove(GameSnapshot const& s) -> PlayerAction
+    template <class Rng>
+    auto BasicRandomAI<Rng>::AttackMove(GameSnapshot const& s) -> PlayerAction
     {
         DRK_ASSERT(!durak::core::util::any_invalid(std::span{s.my_hand}), "No cards in hand should be invalid");
         if (s.my_hand.empty())
             return PassAction{};
 
 
-        size_t used{};
-        for (TableSlotView const& w : s.table)
-        {
-            used += !w.attack.expired();
-        }
-
+        size_t const used = s.attacks_used;
         size_t const def_hand = static_cast<size_t>(s.other_counts[s.defender_idx]);
         size_t const cap = std::min(constants::MaxTableSlots, def_hand);
 
@@ -64,134 +58,181 @@ namespace durak::core
 
         if (used == 0)
         {
-            return AttackAction{std::vector{s.my_hand[pick(s.my_hand)]}};
+            return AttackAction{{s.my_hand[pick(s.my_hand)]}};
         }
 
 
-        constexpr size_t RANK_COUNT = std::to_underlying(durak::core::Rank::Ace) + 1;
-        std::array<uint8_t, RANK_COUNT> counts{};
-        for (TableSlotView const& ts : s.table)
+        DRK_ASSERT(s.my_hand.size() <= constants::MaxDeckSize, "Hand larger than a deck");
+        InlineVec<CardWP, constants::MaxDeckSize> cand;
+        for (CardWP const& c : s.my_hand)
         {
-            if (CardSP const a = ts.attack.lock()) counts[std::to_underlying(a->rank)] = 1;
-            if (CardSP const a = ts.defend.lock()) counts[std::to_underlying(a->rank)] = 1;
+            if ((s.table_ranks >> std::to_underlying(c.lock()->rank)) & 1u) cand.push_back(c);
         }
 
-        auto cand_view = s.my_hand | std::views::filter([&](CardWP const& c)
-        {
-            return counts[std::to_underlying(c.lock()->rank)] != 0;
-        });
-
-        std::vector<CardWP> cand = std::ranges::to<std::vector<CardWP>>(cand_view);
-
         if (cand.empty()) return PassAction{};
 
-        return AttackAction{std::vector{cand[pick(cand)]}};
+        return AttackAction{{cand[pick(cand)]}};
     }
 
-    auto RandomAI::DefendMove(GameSnapshot const& s) -> PlayerAction
+    template <class Rng>
+    auto BasicRandomAI<Rng>::DefendMove(GameSnapshot const& s) -> PlayerAction
     {
-        auto const uncovered = std::ranges::to<std::vector<size_t>>
-        (
-            std::views::iota(size_t{0}, s.table.size()) |
-            std::views::filter([&](size_t i)
-            {
-                auto const& [attack, defend] = s.table[i];
-                return !attack.expired() && defend.expired();
-            })
-        );
+        InlineVec<uint8_t, constants::MaxTableSlots> uncovered;
+        for (size_t i{}; i < s.table.size(); ++i)
+        {
+            auto const& [attack, defend] = s.table[i];
+            if (!attack.expired() && defend.expired()) uncovered.push_back(static_cast<uint8_t>(i));
+        }
         DRK_ASSERT(!uncovered.empty(), "There should be cards to defend");
         DRK_ASSERT(!util::any_invalid(std::span{s.my_hand}), "No cards in hand should be invalid");
+        DRK_ASSERT(s.my_hand.size() <= constants::MaxDeckSize, "Hand larger than a deck");
 
         size_t const u_size = uncovered.size();
         size_t const h_size = s.my_hand.size();
 
         DRK_ASSERT(u_size <= h_size, "More attacks to cover than cards in hand breaks invariant");
 
-        std::vector<CCardSP> attacks{};
-        for (size_t const idx : uncovered)
+        // Beaters of each uncovered attack, straight from the precomputed table.
+        std::array<uint64_t, constants::MaxTableSlots> beaters{};
+        for (size_t k{}; k < u_size; ++k)
         {
-            CardSP const c = s.table[idx].attack.lock();
+            CardSP const c = s.table[uncovered[k]].attack.lock();
             DRK_ASSERT(c, "Uncovered attack vanished");
-            attacks.push_back(c);
+            beaters[k] = masks::Beaters(static_cast<uint8_t>(util::CardToUID(*c)), s.trump);
         }
 
-        std::vector<uint32_t> opt_mask(u_size, 0u);
-        for (size_t k{}; k < u_size; ++k)
+        // 1) Cover signature of each hand card: bit k set if it beats attacks[k] (at most 6 bits).
+        //    Cards with equal signatures are interchangeable, so the matching only sees the groups.
+        constexpr size_t SIGS = size_t{1} << constants::MaxTableSlots;
+        std::array<uint8_t, SIGS> group_of{};
+        std::array<uint8_t, SIGS> group_sig{};
+        std::array<uint8_t, SIGS> group_size{};
+        std::array<uint8_t, constants::MaxDeckSize> card_sig{};
+        size_t groups{};
+        uint8_t covered_by_any{};
+
+        for (size_t j{}; j < h_size; ++j)
         {
-            uint32_t mask{};
-            for (size_t j{}; j < h_size; ++j)
+            CCardSP const c = s.my_hand[j].lock();
+            uint64_t const bit = masks::CardBit(static_cast<uint8_t>(util::CardToUID(*c)));
+            uint8_t sig{};
+            for (size_t k{}; k < u_size; ++k)
             {
-                CCardSP const c = s.my_hand[j].lock();
-                bool const ok = ClassicRules::Beats(*c, *attacks[k], s.trump);
-                mask |= (static_cast<uint32_t>(ok) << j);
+                sig |= static_cast<uint8_t>(((beaters[k] & bit) != 0) << k);
+            }
+            card_sig[j] = sig;
+            covered_by_any |= sig;
+            if (sig == 0) continue; // beats nothing: never part of a cover
+
+            if (group_size[sig]++ == 0)
+            {
+                group_of[sig] = static_cast<uint8_t>(groups);
+                group_sig[groups++] = sig;
             }
-            opt_mask[k] = mask;
-            //short circuit if attack card has no covering options
-            if (mask == 0) return TakeAction{};
         }
 
+        uint8_t const FULL = static_cast<uint8_t>((1u << u_size) - 1u);
+        //short circuit if some attack card has no covering options
+        if (covered_by_any != FULL) return TakeAction{};
 
-        // 4) DP over defender masks to COUNT perfect matchings (full covers)
-        //    dp[pos][mask] = #ways to cover attacks[pos..] using defenders in 'mask'
-        uint32_t const FULL = (h_size == 32 ? 0xFFFFFFFFu : ((1u << h_size) - 1u));
-        size_t const STATES = (1u << h_size);
-        std::vector<uint64_t> dp((u_size + 1) * STATES, 0);
-        auto D = [&](size_t pos, uint32_t mask) -> uint64_t&
+        // k cards of a group of n placed on k distinct attacks: n * (n - 1) * ... * (n - k + 1)
+        auto falling = [](uint64_t n, size_t k) -> uint64_t
         {
-            return dp[pos * STATES + mask];
+            uint64_t r = 1;
+            for (size_t i{}; i < k; ++i) r *= (n - i);
+            return r;
         };
-        for (uint32_t mask = 0; mask < STATES; ++mask)
-            D(u_size, mask) = 1; // base
 
-        for (int pos = static_cast<int>(u_size) - 1; pos >= 0; --pos)
+        // 2) ways[g][mask] = #full covers completing 'mask' (attacks already covered) using groups g..end.
+        //    (groups + 1) * 2^u entries; at most 64 * 64.
+        size_t const STATES = size_t{1} << u_size;
+        ways_.assign((groups + 1) * STATES, 0);
+        auto W = [&](size_t g, uint32_t mask) -> uint64_t&
         {
+            return ways_[g * STATES + mask];
+        };
+        W(groups, FULL) = 1;
+
+        for (size_t g = groups; g-- > 0;)
+        {
+            uint8_t const sig = group_sig[g];
+            uint8_t const n = group_size[sig];
             for (uint32_t mask = 0; mask < STATES; ++mask)
             {
+                uint32_t const avail = sig & ~mask;
                 uint64_t sum = 0;
-                uint32_t avail = opt_mask[pos] & mask;
-                // iterate set bits (branch-light)
-                for (uint32_t mm = avail; mm; mm &= (mm - 1))
+                // every subset of the still-open attacks this group can beat (including none)
+                for (uint32_t sub = avail;; sub = (sub - 1) & avail)
                 {
-                    uint32_t bit = mm & -mm;
-                    sum += D(pos + 1, mask ^ bit);
+                    size_t const k = std::popcount(sub);
+                    if (k <= n) sum += falling(n, k) * W(g + 1, mask | sub);
+                    if (sub == 0) break;
                 }
-                D(pos, mask) = sum;
+                W(g, mask) = sum;
             }
         }
 
-        uint64_t const total = D(0, FULL);
+        uint64_t const total = W(0, 0);
         if (total == 0) return TakeAction{}; // no full cover exists
 
-        // 5) Sample ONE perfect matching uniformly using the DP counts
+        // 3) Sample ONE full cover uniformly: pick each group's attack subset by weight,
+        //    then hand its attacks to distinct random cards of that group.
+        std::array<InlineVec<uint8_t, constants::MaxDeckSize>, SIGS> members;
+        for (size_t j{}; j < h_size; ++j)
+        {
+            if (card_sig[j] != 0) members[group_of[card_sig[j]]].push_back(static_cast<uint8_t>(j));
+        }
+
         uint64_t r = std::uniform_int_distribution<uint64_t>(0, total - 1)(rng_);
-        uint32_t mask = FULL;
-        std::vector<DefendPair> pairs;
-        pairs.reserve(u_size);
+        uint32_t mask = 0;
+        InlineVec<DefendPair, constants::MaxTableSlots> pairs;
 
-        for (size_t pos = 0; pos < u_size; ++pos)
+        for (size_t g = 0; g < groups; ++g)
         {
-            uint32_t avail = opt_mask[pos] & mask;
+            uint8_t const sig = group_sig[g];
+            uint8_t const n = group_size[sig];
+            uint32_t const avail = sig & ~mask;
+            uint32_t chosen_sub = 0;
+            uint64_t pick_r = 0;
             bool chosen = false;
-            for (uint32_t mm = avail; mm; mm &= (mm - 1))
+            for (uint32_t sub = avail;; sub = (sub - 1) & avail)
             {
-                uint32_t bit = mm & -mm;
-                uint64_t w = D(pos + 1, mask ^ bit);
+                size_t const k = std::popcount(sub);
+                uint64_t const w = (k <= n) ? falling(n, k) * W(g + 1, mask | sub) : 0;
                 if (w > r)
                 {
-                    size_t j = std::countr_zero(bit);
-                    pairs.push_back(DefendPair{
-                        .attack = s.table[uncovered[pos]].attack,
-                        .defend = s.my_hand[j]
-                    });
-                    mask ^= bit;
+                    // split r into the ordered card choice (mixed radix) and the rest of the cover
+                    uint64_t const f = falling(n, k);
+                    pick_r = r % f;
+                    r /= f;
+                    chosen_sub = sub;
                     chosen = true;
                     break;
                 }
                 r -= w;
+                if (sub == 0) break;
             }
             DRK_ASSERT(chosen, "Random sampling failed despite positive total count");
+
+            InlineVec<uint8_t, constants::MaxDeckSize>& pool = members[g];
+            for (uint32_t mm = chosen_sub; mm; mm &= (mm - 1))
+            {
+                size_t const k = std::countr_zero(mm);
+                size_t const pick_idx = static_cast<size_t>(pick_r % pool.size());
+                pick_r /= pool.size();
+                pairs.push_back(DefendPair{
+                    .attack = s.table[uncovered[k]].attack,
+                    .defend = s.my_hand[pool[pick_idx]]
+                });
+                pool[pick_idx] = pool.back();
+                pool.pop_back();
+            }
+            mask |= chosen_sub;
         }
 
         return DefendAction{std::move(pairs)};
     }
+
+    template class BasicRandomAI<std::mt19937>;
+    template class BasicRandomAI<CounterRng>;
 }
\ No newline at end of file
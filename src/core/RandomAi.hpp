@@ -7,15 +7,20 @@
 
 #include "Player.hpp"
 #include "ClassicRules.hpp"
+#include "CounterRng.hpp"
+#include "InlineVec.hpp"
 #include "State.hpp"
 #include "Types.hpp"
 
 namespace durak::core
 {
-    class RandomAI final : public durak::core::Player
+    // Uniformly random legal play. Rng is any std::uniform_random_bit_generator seedable from a uint64_t;
+    // the definitions are instantiated in RandomAi.cpp for the aliases below.
+    template <class Rng>
+    class BasicRandomAI final : public durak::core::Player
     {
     public:
-        explicit RandomAI(uint64_t rng_seed);
+        explicit BasicRandomAI(uint64_t rng_seed);
 
         auto Play(std::shared_ptr<const durak::core::GameSnapshot> snapshot,
                   std::chrono::steady_clock::time_point deadline) -> durak::core::PlayerAction override;
@@ -31,8 +36,15 @@ namespace durak::core
         auto DefendMove(durak::core::GameSnapshot const&) -> durak::core::PlayerAction;
 
     private:
-        std::mt19937 rng_;
+        Rng rng_;
+        std::vector<uint64_t> ways_; // DefendMove's cover counts, kept so steady-state play does not allocate
     };
+
+    using RandomAI = BasicRandomAI<std::mt19937>;
+    using CounterRandomAI = BasicRandomAI<CounterRng>;
+
+    extern template class BasicRandomAI<std::mt19937>;
+    extern template class BasicRandomAI<CounterRng>;
 }
 
 #endif //IDIOTGAME_RANDOMAI_HPP
\ No newline at end of file
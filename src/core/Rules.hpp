@@ -5,7 +5,11 @@
 #ifndef IDIOTGAME_RULES_HPP
 #define IDIOTGAME_RULES_HPP
 
+#include <expected>
+#include <optional>
+
 #include "Actions.hpp"
+#include "InlineVec.hpp"
 #include "Types.hpp"
 #include "Exception.hpp"
 
@@ -14,21 +18,37 @@ namespace durak::core
     //forward declaration
     class GameImpl;
 
+    // An accepted action resolved to positions: which hand cards go to which table slots, and the bout
+    // cap to pin. Only valid for the state it was validated against; Apply executes it without searching.
+    struct ActionPlan
+    {
+        struct Placement
+        {
+            uint8_t hand_idx{}; // position in the mover's hand
+            uint8_t slot{}; // table slot: attack side for attacks, defend side for covers
+        };
+
+        // Sorted by descending hand_idx, so each removal leaves the remaining indices valid
+        InlineVec<Placement, constants::MaxTableSlots> placements;
+        std::optional<uint8_t> pin_cap; // first attack of a bout pins bout_cap_ to this
+    };
+
     class Rules
     {
     public:
-        using CheckResult = error::ValidateResult;
+        using CheckResult = std::expected<ActionPlan, error::RuleViolation>;
 
         virtual ~Rules() = default;
 
-        // Returns unexpected(reason) for ordinary rule violations (NOT exceptions).
-        // Throw only for engine misuse / broken invariants.
+        // Returns unexpected(reason) for ordinary rule violations (NOT exceptions), otherwise the plan.
+        // Broken engine invariants are reported as RuleViolationCode::Internal_Unreachable.
         virtual auto Validate(GameImpl const& game, PlayerAction const& a) const -> CheckResult = 0;
 
-        // Mutate authoritative state (move shared_ptr<Card> hand <-> table <-> discard).
-        virtual auto Apply(GameImpl& game, PlayerAction const& a) -> void = 0;
+        // Mutate authoritative state (move shared_ptr<Card> hand <-> table <-> discard) as planned by
+        // Validate on this same state. Errors here are engine misuse / broken invariants, never player mistakes.
+        virtual auto Apply(GameImpl& game, PlayerAction const& a, ActionPlan const& plan) -> error::Result<> = 0;
 
-        virtual auto Advance(GameImpl& game) -> MoveOutcome = 0;
+        virtual auto Advance(GameImpl& game) -> error::Result<MoveOutcome> = 0;
     };
 }
 
@@ -0,0 +1,93 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_SHAPE_HPP
+#define IDIOTGAME_SHAPE_HPP
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include "Types.hpp"
+
+namespace durak::core
+{
+    // Seat count and deck size known at compile time: seat arithmetic folds to constants.
+    template <uint8_t Players, bool Deck36>
+    struct FixedShape
+    {
+        static_assert(Players >= 2 && Players <= constants::MaxPlayers, "FixedShape seat count out of range");
+
+        static constexpr auto Seats(size_t) noexcept -> size_t { return Players; }
+
+        static constexpr auto Fits(size_t const players, bool const deck36) noexcept -> bool
+        {
+            return players == Players && deck36 == Deck36;
+        }
+    };
+
+    // Seat count known at compile time, any deck: for games that Restore every position, where the deal
+    // comes from the image and the deck size never reaches the rules.
+    template <uint8_t Players>
+    struct FixedSeats
+    {
+        static_assert(Players >= 2 && Players <= constants::MaxPlayers, "FixedSeats seat count out of range");
+
+        static constexpr auto Seats(size_t) noexcept -> size_t { return Players; }
+        static constexpr auto Fits(size_t const players, bool) noexcept -> bool { return players == Players; }
+    };
+
+    // Seat count read from the game at run time; fits any configuration.
+    struct DynamicShape
+    {
+        static constexpr auto Seats(size_t const n) noexcept -> size_t { return n; }
+        static constexpr auto Fits(size_t, bool) noexcept -> bool { return true; }
+    };
+
+    // Heads-up with the 36-card deck, the bulk of all games played.
+    using HeadsUp36 = FixedShape<2, true>;
+
+    // Calls f with the most specialised shape that fits cfg (a tag value), falling back to DynamicShape.
+    template <class F>
+    auto DispatchShape(Config const& cfg, F&& f) -> decltype(auto)
+    {
+        if (HeadsUp36::Fits(cfg.n_players, cfg.deck36)) return std::forward<F>(f)(HeadsUp36{});
+        return std::forward<F>(f)(DynamicShape{});
+    }
+
+    // As DispatchShape, on the seat count alone.
+    template <class F>
+    auto DispatchSeats(size_t const n_players, F&& f) -> decltype(auto)
+    {
+        if (FixedSeats<2>::Fits(n_players, true)) return std::forward<F>(f)(FixedSeats<2>{});
+        return std::forward<F>(f)(DynamicShape{});
+    }
+
+    // Card uids (util::CardToUID) of a fresh deck, suit-major with ranks ascending.
+    template <bool Deck36>
+    inline constexpr auto DeckTemplate = []
+    {
+        constexpr uint8_t first = Deck36 ? static_cast<uint8_t>(Rank::Six) : static_cast<uint8_t>(Rank::Two);
+        std::array<uint8_t, Deck36 ? 36 : 52> out{};
+        size_t n = 0;
+        for (uint8_t suit = 0; suit < 4; ++suit)
+        {
+            for (uint8_t rank = first; rank <= static_cast<uint8_t>(Rank::Ace); ++rank)
+            {
+                out[n++] = static_cast<uint8_t>(suit * 13 + rank);
+            }
+        }
+        return out;
+    }();
+
+    template <bool Deck36>
+    inline constexpr uint64_t DeckMask = []
+    {
+        uint64_t m = 0;
+        for (uint8_t const id : DeckTemplate<Deck36>) m |= uint64_t{1} << id;
+        return m;
+    }();
+}
+
+#endif //IDIOTGAME_SHAPE_HPP
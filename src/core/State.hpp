@@ -27,7 +27,14 @@ namespace durak::core
 
         uint8_t bout_cap{};
         uint8_t attacks_used{};
+        uint16_t table_ranks{}; // bit r = some table card has rank r
         bool defender_took{false};
+
+        // Public counts for search bots: cards left in the deck, the refill target, and every card
+        // this seat cannot see (opponent hands + deck) as util::CardToUID bits.
+        uint8_t deck_count{};
+        uint8_t deal_up_to{};
+        uint64_t unseen_mask{};
     };
 } // namespace durak::core
 
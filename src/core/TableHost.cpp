@@ -0,0 +1,89 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "TableHost.hpp"
+
+#include <utility>
+
+#include "Judge.hpp"
+
+namespace durak::core
+{
+    TableHost::TableHost(Config const& config, std::unique_ptr<Rules> rules, TimerWheel& wheel, Hooks hooks) :
+        game_(config, std::move(rules)),
+        wheel_(wheel),
+        gate_(config.n_players, hooks.on_violation_summary),
+        hooks_(std::move(hooks))
+    {
+    }
+
+    TableHost::~TableHost()
+    {
+        wheel_.Cancel(deadline_);
+    }
+
+    auto TableHost::Start(Clock::time_point const now) -> void
+    {
+        Arm(now);
+    }
+
+    auto TableHost::Submit(PlyrIdxT const seat, PlayerAction const& action, Clock::time_point const now) -> bool
+    {
+        if (finished_ || seat != game_.CurrentActor()) return false;
+
+        auto out = game_.TryResolve(action);
+        if (!out) error::raise(out.error());
+
+        if (*out == MoveOutcome::Invalid)
+        {
+            error::RuleViolation const v = *game_.LastViolation();
+            if (hooks_.on_violation) hooks_.on_violation(seat, v);
+            if (gate_.OnViolation(seat, v, now) == ViolationGate::Verdict::Retry)
+            {
+                // Same decision, same deadline: retries never extend the turn
+                if (hooks_.on_decision) hooks_.on_decision(seat, deadline_at_);
+                return true;
+            }
+            out = Forfeit(seat);
+        }
+        wheel_.Cancel(deadline_);
+        Finish(*out, now);
+        return true;
+    }
+
+    auto TableHost::Arm(Clock::time_point const now) -> void
+    {
+        deadline_at_ = now + game_.Cfg().turn_timeout;
+        deadline_ = wheel_.Schedule(deadline_at_, [this] { OnDeadline(deadline_at_); });
+        if (hooks_.on_decision) hooks_.on_decision(game_.CurrentActor(), deadline_at_);
+    }
+
+    auto TableHost::OnDeadline(Clock::time_point const when) -> void
+    {
+        deadline_ = {};
+        ++timeouts_;
+        Finish(Forfeit(game_.CurrentActor()), when);
+    }
+
+    auto TableHost::Forfeit(PlyrIdxT const seat) -> MoveOutcome
+    {
+        auto const fallback = Judge::DefaultAction(game_, seat);
+        if (!fallback) error::raise(fallback.error());
+        return game_.Resolve(*fallback);
+    }
+
+    auto TableHost::Finish(MoveOutcome const out, Clock::time_point const now) -> void
+    {
+        gate_.OnAccepted(game_.LastActor());
+        if (hooks_.on_step) hooks_.on_step(out);
+
+        if (out == MoveOutcome::GameEnded)
+        {
+            finished_ = true;
+            gate_.Flush();
+            return;
+        }
+        Arm(now);
+    }
+}
@@ -0,0 +1,72 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_TABLEHOST_HPP
+#define IDIOTGAME_TABLEHOST_HPP
+
+#include <functional>
+#include <memory>
+
+#include "Exception.hpp"
+#include "Game.hpp"
+#include "Rules.hpp"
+#include "TimerWheel.hpp"
+#include "Types.hpp"
+#include "ViolationGate.hpp"
+
+namespace durak::core
+{
+    // Event-driven host for one table: actions are pushed in with Submit() and the actor's deadline is a
+    // TimerWheel entry, so no thread waits on a decision. When a deadline fires, or a seat spends its
+    // ViolationGate budget, Judge::DefaultAction is resolved in its place.
+    // Not thread-safe: call it, and advance the wheel, from the one event loop.
+    class TableHost
+    {
+    public:
+        using Clock = TimerWheel::Clock;
+
+        struct Hooks
+        {
+            std::function<void(MoveOutcome)> on_step; // an action (submitted or default) was applied
+            std::function<void(PlyrIdxT, error::RuleViolation const&)> on_violation;
+            // seat is up, answer by deadline (again after a retryable violation, with the same deadline)
+            std::function<void(PlyrIdxT, Clock::time_point)> on_decision;
+            ViolationGate::Sink on_violation_summary; // periodic per-seat violation counts (ViolationGate)
+        };
+
+        TableHost(Config const& config, std::unique_ptr<Rules> rules, TimerWheel& wheel, Hooks hooks);
+        ~TableHost();
+
+        TableHost(TableHost const&) = delete;
+        auto operator=(TableHost const&) -> TableHost& = delete;
+
+        // Arms the first decision.
+        auto Start(Clock::time_point now) -> void;
+        // False (and ignored) when the game is over or it is not 'seat''s turn.
+        auto Submit(PlyrIdxT seat, PlayerAction const& action, Clock::time_point now) -> bool;
+
+        auto Game() noexcept -> GameImpl& { return game_; }
+        auto Game() const noexcept -> GameImpl const& { return game_; }
+        auto Finished() const noexcept -> bool { return finished_; }
+        auto Timeouts() const noexcept -> uint32_t { return timeouts_; }
+        auto Gate() noexcept -> ViolationGate& { return gate_; }
+
+    private:
+        auto Arm(Clock::time_point now) -> void;
+        auto OnDeadline(Clock::time_point when) -> void;
+        auto Forfeit(PlyrIdxT seat) -> MoveOutcome;
+        auto Finish(MoveOutcome out, Clock::time_point now) -> void;
+
+        GameImpl game_;
+        TimerWheel& wheel_;
+        ViolationGate gate_;
+        Hooks hooks_;
+        TimerWheel::TimerId deadline_{};
+        Clock::time_point deadline_at_{}; // of the current decision, kept across retries
+        bool finished_{false};
+        uint32_t timeouts_{0};
+    };
+}
+
+#endif //IDIOTGAME_TABLEHOST_HPP
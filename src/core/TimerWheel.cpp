@@ -0,0 +1,135 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "TimerWheel.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace durak::core
+{
+    TimerWheel::TimerWheel(Clock::time_point const start, std::chrono::milliseconds const tick) :
+        start_(start),
+        tick_(std::max(tick, std::chrono::milliseconds(1)))
+    {
+        heads_.fill(NoNode);
+    }
+
+    // Deadlines round up to a tick, so nothing fires early.
+    auto TimerWheel::TickOf(Clock::time_point const t) const -> uint64_t
+    {
+        if (t <= start_) return 0;
+        auto const span = std::chrono::duration_cast<std::chrono::nanoseconds>(t - start_).count();
+        auto const per = std::chrono::duration_cast<std::chrono::nanoseconds>(tick_).count();
+        return static_cast<uint64_t>((span + per - 1) / per);
+    }
+
+    auto TimerWheel::Schedule(Clock::time_point const when, Callback cb) -> TimerId
+    {
+        uint32_t n = free_;
+        if (n != NoNode)
+        {
+            free_ = nodes_[n].next;
+        }
+        else
+        {
+            n = static_cast<uint32_t>(nodes_.size());
+            nodes_.emplace_back();
+        }
+
+        Node& node = nodes_[n];
+        node.cb = std::move(cb);
+        node.expiry = std::max(TickOf(when), now_ + 1);
+        node.live = true;
+        File(n);
+        ++pending_;
+        return TimerId{n, node.gen};
+    }
+
+    auto TimerWheel::Cancel(TimerId const id) -> bool
+    {
+        if (id.node >= nodes_.size()) return false;
+        Node& node = nodes_[id.node];
+        if (!node.live || node.gen != id.gen) return false;
+
+        Unlink(id.node);
+        node.cb = nullptr;
+        node.live = false;
+        ++node.gen;
+        node.next = free_;
+        free_ = id.node;
+        --pending_;
+        return true;
+    }
+
+    auto TimerWheel::Advance(Clock::time_point const now) -> size_t
+    {
+        auto const span = std::chrono::duration_cast<std::chrono::nanoseconds>(now - start_).count();
+        auto const per = std::chrono::duration_cast<std::chrono::nanoseconds>(tick_).count();
+        uint64_t const target = span <= 0 ? 0 : static_cast<uint64_t>(span / per);
+
+        size_t fired = 0;
+        while (now_ < target)
+        {
+            ++now_;
+
+            // Entering a new lap of a level: pull its next slot down, outermost level first
+            if ((now_ & (Slots - 1)) == 0)
+            {
+                unsigned top = 1;
+                while (top < Levels - 1 && ((now_ >> (SlotBits * top)) & (Slots - 1)) == 0) ++top;
+                for (unsigned level = top; level >= 1; --level) Cascade(level);
+            }
+
+            uint32_t& head = heads_[now_ & (Slots - 1)];
+            while (head != NoNode)
+            {
+                uint32_t const n = head;
+                Callback cb = std::move(nodes_[n].cb);
+                Cancel(TimerId{n, nodes_[n].gen});
+                ++fired;
+                cb();
+            }
+        }
+        return fired;
+    }
+
+    auto TimerWheel::File(uint32_t const n) -> void
+    {
+        Node& node = nodes_[n];
+        uint64_t const delta = node.expiry - now_;
+
+        unsigned level = 0;
+        while (level < Levels - 1 && delta >= (uint64_t{1} << (SlotBits * (level + 1)))) ++level;
+        // Past the top level's reach: park in its furthest slot and get re-filed when that comes round
+        uint64_t const at = std::min(node.expiry, now_ + (uint64_t{1} << (SlotBits * Levels)) - 1);
+
+        node.bucket = static_cast<uint16_t>(level * Slots + ((at >> (SlotBits * level)) & (Slots - 1)));
+        node.prev = NoNode;
+        node.next = heads_[node.bucket];
+        if (node.next != NoNode) nodes_[node.next].prev = n;
+        heads_[node.bucket] = n;
+    }
+
+    auto TimerWheel::Unlink(uint32_t const n) -> void
+    {
+        Node& node = nodes_[n];
+        if (node.prev != NoNode) nodes_[node.prev].next = node.next;
+        else heads_[node.bucket] = node.next;
+        if (node.next != NoNode) nodes_[node.next].prev = node.prev;
+        node.prev = node.next = NoNode;
+    }
+
+    auto TimerWheel::Cascade(unsigned const level) -> void
+    {
+        uint32_t& head = heads_[level * Slots + ((now_ >> (SlotBits * level)) & (Slots - 1))];
+        uint32_t n = std::exchange(head, NoNode);
+        while (n != NoNode)
+        {
+            uint32_t const next = nodes_[n].next;
+            File(n);
+            n = next;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_TIMERWHEEL_HPP
+#define IDIOTGAME_TIMERWHEEL_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace durak::core
+{
+    // Hierarchical timer wheel for decision deadlines: four levels of 64 slots at 'tick' resolution
+    // (about 4.6 hours of range at 1 ms; later deadlines wait in the top level and are re-filed).
+    // Schedule and Cancel are O(1); Advance fires what fell due, in tick order. Timers live in a slab
+    // reused through a free list, so steady-state hosting does not allocate beyond the callbacks.
+    // Single-threaded: drive it from the event loop that owns it. Callbacks may schedule and cancel.
+    class TimerWheel
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Callback = std::function<void()>;
+
+        // Names one scheduled timer; stale once it fired or was cancelled.
+        struct TimerId
+        {
+            uint32_t node{NoNode};
+            uint32_t gen{0};
+
+            auto Valid() const noexcept -> bool { return node != NoNode; }
+        };
+
+        explicit TimerWheel(Clock::time_point start, std::chrono::milliseconds tick = std::chrono::milliseconds(1));
+
+        // Fires cb on the first Advance() that reaches 'when' (deadlines already past fire on the next tick).
+        auto Schedule(Clock::time_point when, Callback cb) -> TimerId;
+        // False if the timer already fired or was cancelled.
+        auto Cancel(TimerId id) -> bool;
+        // Fires every timer due by 'now'. Returns how many fired.
+        auto Advance(Clock::time_point now) -> size_t;
+
+        auto Pending() const noexcept -> size_t { return pending_; }
+        auto Tick() const noexcept -> std::chrono::milliseconds { return tick_; }
+
+    private:
+        static constexpr uint32_t NoNode = 0xFFFFFFFF;
+        static constexpr unsigned SlotBits = 6;
+        static constexpr unsigned Slots = 1u << SlotBits;
+        static constexpr unsigned Levels = 4;
+
+        struct Node
+        {
+            Callback cb;
+            uint64_t expiry{0}; // in ticks
+            uint32_t prev{NoNode};
+            uint32_t next{NoNode};
+            uint32_t gen{0};
+            uint16_t bucket{0}; // level * Slots + slot
+            bool live{false};
+        };
+
+        auto TickOf(Clock::time_point t) const -> uint64_t;
+        auto File(uint32_t n) -> void; // links node n into the bucket its expiry maps to from now_
+        auto Unlink(uint32_t n) -> void;
+        auto Cascade(unsigned level) -> void;
+
+        Clock::time_point start_;
+        std::chrono::milliseconds tick_;
+        uint64_t now_{0}; // last tick processed
+        size_t pending_{0};
+        std::array<uint32_t, Levels * Slots> heads_{};
+        std::vector<Node> nodes_;
+        uint32_t free_{NoNode};
+    };
+}
+
+#endif //IDIOTGAME_TIMERWHEEL_HPP
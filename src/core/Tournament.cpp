@@ -0,0 +1,354 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "Tournament.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <thread>
+#include <utility>
+
+#include "ClassicPolicy.hpp"
+#include "CounterRng.hpp"
+#include "Game.hpp"
+#include "IsmctsAi.hpp"
+#include "Judge.hpp"
+#include "RandomAi.hpp"
+
+namespace durak::core
+{
+    namespace
+    {
+        auto SplitMix(uint64_t x) -> uint64_t
+        {
+            x += 0x9E3779B97F4A7C15ull;
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+            return x ^ (x >> 31);
+        }
+
+        // Bot seeds by seat; each seat keeps its seed when the pairing swaps sides.
+        using SeatSeeds = std::array<uint64_t, 2>;
+
+        struct DuelResult
+        {
+            int8_t loser{-1}; // -1 = draw
+            bool engine_error{false};
+            std::array<BotStats, 2> seats{};
+        };
+
+        // Drives a player-less game on this thread, so no Judge timeouts can make the result timing dependent.
+        template <class G>
+        auto PlayDuelOn(BotFactory const& seat0, BotFactory const& seat1, Config const& gc, SeatSeeds const& seeds,
+                        uint32_t const max_plies, DuelObserver* const observer) -> DuelResult
+        {
+            DuelResult r{};
+            std::array<std::unique_ptr<Player>, 2> const players{seat0(seeds[0]), seat1(seeds[1])};
+            G game(gc);
+
+            for (uint32_t ply = 0; ply < max_plies; ++ply)
+            {
+                PlyrIdxT const actor = game.CurrentActor();
+                BotStats& st = r.seats[actor];
+
+                std::shared_ptr<GameSnapshot const> snap = game.SnapshotFor(actor);
+                auto const t0 = std::chrono::steady_clock::now();
+                PlayerAction const action = players[actor]->Play(snap, t0 + gc.turn_timeout);
+                st.think += std::chrono::steady_clock::now() - t0;
+                ++st.decisions;
+                if (observer != nullptr) observer->Decision(*snap, actor, action);
+
+                auto out = game.TryResolve(action);
+                if (out && *out == MoveOutcome::Invalid)
+                {
+                    ++st.violations;
+                    auto const fallback = Judge::DefaultAction(game, actor);
+                    out = fallback ? game.TryResolve(*fallback) : std::unexpected(fallback.error());
+                }
+                if (!out || *out == MoveOutcome::Invalid)
+                {
+                    r.engine_error = true;
+                    break;
+                }
+                if (*out == MoveOutcome::GameEnded)
+                {
+                    if (game.HandSize(0) != 0) r.loser = 0;
+                    else if (game.HandSize(1) != 0) r.loser = 1;
+                    break;
+                }
+            }
+
+            if (observer != nullptr)
+            {
+                std::optional<PlyrIdxT> loser{};
+                if (r.loser >= 0) loser = static_cast<PlyrIdxT>(r.loser);
+                observer->EndGame(loser);
+            }
+            return r;
+        }
+
+        // Heads-up 36-card deals take the fixed-shape engine.
+        auto PlayDuel(BotFactory const& seat0, BotFactory const& seat1, Config const& gc, SeatSeeds const& seeds,
+                      uint32_t const max_plies, DuelObserver* const observer) -> DuelResult
+        {
+            return DispatchShape(gc, [&]<class S>(S) -> DuelResult
+            {
+                return PlayDuelOn<BasicClassicGame<S>>(seat0, seat1, gc, seeds, max_plies, observer);
+            });
+        }
+
+        auto Add(BotStats& into, BotStats const& s) -> void
+        {
+            into.decisions += s.decisions;
+            into.violations += s.violations;
+            into.think += s.think;
+        }
+
+        // Solves h * x = I for the inverse's diagonal (h is small and positive definite).
+        auto InverseDiagonal(std::vector<std::vector<double>> h) -> std::vector<double>
+        {
+            size_t const n = h.size();
+            std::vector<std::vector<double>> inv(n, std::vector<double>(n, 0.0));
+            for (size_t i = 0; i < n; ++i) inv[i][i] = 1.0;
+
+            for (size_t c = 0; c < n; ++c)
+            {
+                size_t piv = c;
+                for (size_t r = c + 1; r < n; ++r)
+                {
+                    if (std::abs(h[r][c]) > std::abs(h[piv][c])) piv = r;
+                }
+                std::swap(h[c], h[piv]);
+                std::swap(inv[c], inv[piv]);
+                double const d = h[c][c];
+                if (std::abs(d) < 1e-300) return std::vector<double>(n, std::numeric_limits<double>::infinity());
+                for (size_t k = 0; k < n; ++k)
+                {
+                    h[c][k] /= d;
+                    inv[c][k] /= d;
+                }
+                for (size_t r = 0; r < n; ++r)
+                {
+                    if (r == c || h[r][c] == 0.0) continue;
+                    double const f = h[r][c];
+                    for (size_t k = 0; k < n; ++k)
+                    {
+                        h[r][k] -= f * h[c][k];
+                        inv[r][k] -= f * inv[c][k];
+                    }
+                }
+            }
+
+            std::vector<double> diag(n);
+            for (size_t i = 0; i < n; ++i) diag[i] = inv[i][i];
+            return diag;
+        }
+    }
+
+    auto MakeBot(std::string_view const spec) -> std::optional<BotEntry>
+    {
+        std::string_view const kind = spec.substr(0, spec.find(':'));
+        std::string_view const arg = (kind.size() < spec.size()) ? spec.substr(kind.size() + 1) : std::string_view{};
+
+        if (kind == "random" && arg.empty())
+        {
+            return BotEntry{std::string{spec}, [](uint64_t seed) { return std::make_unique<RandomAI>(seed); }};
+        }
+        if (kind == "random" && arg == "counter")
+        {
+            return BotEntry{std::string{spec}, [](uint64_t seed) { return std::make_unique<CounterRandomAI>(seed); }};
+        }
+        if (kind == "ismcts")
+        {
+            IsmctsConfig ic{};
+            ic.threads = 1;
+            ic.max_iterations = 200;
+            ic.endgame_share = 0.0; // the solver is deadline bound
+            if (!arg.empty())
+            {
+                auto const res = std::from_chars(arg.data(), arg.data() + arg.size(), ic.max_iterations);
+                if (res.ec != std::errc{} || res.ptr != arg.data() + arg.size() || ic.max_iterations == 0)
+                {
+                    return std::nullopt;
+                }
+            }
+            return BotEntry{std::string{spec}, [ic](uint64_t seed) { return std::make_unique<IsmctsAI>(seed, ic); }};
+        }
+        return std::nullopt;
+    }
+
+    auto RunTournament(std::span<BotEntry const> const bots, TournamentConfig const& cfg) -> TournamentReport
+    {
+        TournamentReport rep{};
+        rep.bots.resize(bots.size());
+        for (uint32_t a = 0; a < bots.size(); ++a)
+        {
+            for (uint32_t b = a + 1; b < bots.size(); ++b)
+            {
+                if (cfg.format == TournamentFormat::Gauntlet && a != 0) break;
+                rep.pairs.push_back(PairStats{.a = a, .b = b});
+            }
+        }
+
+        uint64_t const total = rep.pairs.size() * uint64_t{cfg.deals};
+        unsigned const wanted = cfg.threads != 0 ? cfg.threads : std::thread::hardware_concurrency();
+        auto const threads = static_cast<unsigned>(std::clamp<uint64_t>(total, 1, std::max(wanted, 1u)));
+
+        std::atomic<uint64_t> next{0};
+        std::vector<TournamentReport> partial(threads, rep);
+
+        auto worker = [&](unsigned const t)
+        {
+            TournamentReport& mine = partial[t];
+            std::unique_ptr<DuelObserver> const observer = cfg.observer ? cfg.observer(t) : nullptr;
+            for (uint64_t k = next.fetch_add(1); k < total; k = next.fetch_add(1))
+            {
+                PairStats& ps = mine.pairs[k / cfg.deals];
+                uint64_t const deal = k % cfg.deals;
+
+                // Deal i is the same shuffle for every pairing
+                Config gc{};
+                gc.n_players = 2;
+                gc.deal_up_to = cfg.deal_up_to;
+                gc.deck36 = cfg.deck36;
+                gc.counter_rng = cfg.counter_rng;
+                gc.seed = cfg.counter_rng ? CounterRng::SeedFor(cfg.seed, deal, CounterRng::DeckStream)
+                                          : SplitMix(cfg.seed ^ SplitMix(deal));
+                SeatSeeds const seeds = cfg.counter_rng
+                                            ? SeatSeeds{CounterRng::SeedFor(cfg.seed, deal, 0),
+                                                        CounterRng::SeedFor(cfg.seed, deal, 1)}
+                                            : SeatSeeds{SplitMix(gc.seed ^ 0xA11CEull), SplitMix(gc.seed ^ 0xB0Bull)};
+
+                BotFactory const& fa = bots[ps.a].make;
+                BotFactory const& fb = bots[ps.b].make;
+                DuelResult const g1 = PlayDuel(fa, fb, gc, seeds, cfg.max_plies, observer.get()); // a in seat 0
+                DuelResult const g2 = PlayDuel(fb, fa, gc, seeds, cfg.max_plies, observer.get()); // a in seat 1
+
+                int a_won = 0;
+                int b_won = 0;
+                for (auto const& [g, a_seat] : {std::pair{&g1, 0}, std::pair{&g2, 1}})
+                {
+                    Add(mine.bots[ps.a], g->seats[a_seat]);
+                    Add(mine.bots[ps.b], g->seats[1 - a_seat]);
+                    mine.engine_errors += g->engine_error;
+                    if (g->loser < 0)
+                    {
+                        ++ps.draws;
+                    }
+                    else if (g->loser == a_seat)
+                    {
+                        ++ps.b_wins;
+                        ++b_won;
+                    }
+                    else
+                    {
+                        ++ps.a_wins;
+                        ++a_won;
+                    }
+                }
+                ps.a_sweeps += (a_won == 2);
+                ps.b_sweeps += (b_won == 2);
+            }
+        };
+
+        {
+            std::vector<std::jthread> helpers;
+            helpers.reserve(threads - 1);
+            for (unsigned t = 1; t < threads; ++t) helpers.emplace_back(worker, t);
+            worker(0);
+        }
+
+        // Integer sums: the merge order cannot change the result
+        for (TournamentReport const& p : partial)
+        {
+            for (size_t i = 0; i < rep.pairs.size(); ++i)
+            {
+                rep.pairs[i].a_wins += p.pairs[i].a_wins;
+                rep.pairs[i].b_wins += p.pairs[i].b_wins;
+                rep.pairs[i].draws += p.pairs[i].draws;
+                rep.pairs[i].a_sweeps += p.pairs[i].a_sweeps;
+                rep.pairs[i].b_sweeps += p.pairs[i].b_sweeps;
+            }
+            for (size_t i = 0; i < rep.bots.size(); ++i) Add(rep.bots[i], p.bots[i]);
+            rep.engine_errors += p.engine_errors;
+        }
+
+        rep.ratings = FitBradleyTerry(bots.size(), rep.pairs);
+        return rep;
+    }
+
+    auto FitBradleyTerry(size_t const n_bots, std::span<PairStats const> const pairs) -> std::vector<Rating>
+    {
+        std::vector<Rating> out(n_bots);
+        if (n_bots < 2) return out;
+
+        // wins[i][j]: i's score against j (draws half); games[i][j] symmetric. One virtual draw per pairing.
+        std::vector<std::vector<double>> wins(n_bots, std::vector<double>(n_bots, 0.0));
+        std::vector<std::vector<double>> games(n_bots, std::vector<double>(n_bots, 0.0));
+        for (PairStats const& p : pairs)
+        {
+            wins[p.a][p.b] += p.a_wins + 0.5 * p.draws + 0.5;
+            wins[p.b][p.a] += p.b_wins + 0.5 * p.draws + 0.5;
+            games[p.a][p.b] += p.Games() + 1.0;
+            games[p.b][p.a] += p.Games() + 1.0;
+        }
+
+        // Minorization-maximization (Hunter 2004), strengths normalised to bots[0] = 1
+        std::vector<double> s(n_bots, 1.0);
+        for (int iter = 0; iter < 10000; ++iter)
+        {
+            double change = 0.0;
+            for (size_t i = 0; i < n_bots; ++i)
+            {
+                double w = 0.0;
+                double denom = 0.0;
+                for (size_t j = 0; j < n_bots; ++j)
+                {
+                    if (games[i][j] == 0.0) continue;
+                    w += wins[i][j];
+                    denom += games[i][j] / (s[i] + s[j]);
+                }
+                if (denom == 0.0) continue; // never played: stays at bots[0]'s level
+                double const next = w / denom;
+                change = std::max(change, std::abs(std::log(next / s[i])));
+                s[i] = next;
+            }
+            double const anchor = s[0];
+            for (double& v : s) v /= anchor;
+            if (change < 1e-12) break;
+        }
+
+        // Observed information for log-strengths with bots[0] fixed
+        std::vector<std::vector<double>> h(n_bots - 1, std::vector<double>(n_bots - 1, 0.0));
+        for (size_t i = 0; i < n_bots; ++i)
+        {
+            for (size_t j = i + 1; j < n_bots; ++j)
+            {
+                if (games[i][j] == 0.0) continue;
+                double const f = games[i][j] * s[i] * s[j] / ((s[i] + s[j]) * (s[i] + s[j]));
+                if (i != 0) h[i - 1][i - 1] += f;
+                h[j - 1][j - 1] += f;
+                if (i != 0)
+                {
+                    h[i - 1][j - 1] -= f;
+                    h[j - 1][i - 1] -= f;
+                }
+            }
+        }
+        std::vector<double> const var = InverseDiagonal(std::move(h));
+
+        double const to_elo = 400.0 / std::numbers::ln10;
+        for (size_t i = 1; i < n_bots; ++i)
+        {
+            out[i].elo = to_elo * std::log(s[i]);
+            out[i].ci95 = 1.96 * to_elo * std::sqrt(std::max(var[i - 1], 0.0));
+        }
+        return out;
+    }
+}
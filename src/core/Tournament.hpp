@@ -0,0 +1,112 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_TOURNAMENT_HPP
+#define IDIOTGAME_TOURNAMENT_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Actions.hpp"
+#include "Player.hpp"
+#include "State.hpp"
+#include "Types.hpp"
+
+namespace durak::core
+{
+    using BotFactory = std::function<std::unique_ptr<Player>(uint64_t seed)>;
+
+    struct BotEntry
+    {
+        std::string name;
+        BotFactory make;
+    };
+
+    // Registered bots: "random[:counter]" and "ismcts[:iterations]" (single-threaded, iteration-capped so
+    // results only depend on seeds). Empty for an unknown spec.
+    auto MakeBot(std::string_view spec) -> std::optional<BotEntry>;
+
+    // Sees every decision of the games played on one worker thread.
+    class DuelObserver
+    {
+    public:
+        virtual ~DuelObserver() = default;
+
+        virtual auto Decision(GameSnapshot const& s, PlyrIdxT seat, PlayerAction const& chosen) -> void = 0;
+        // Empty loser for a draw or an abandoned game.
+        virtual auto EndGame(std::optional<PlyrIdxT> loser) -> void = 0;
+    };
+
+    enum class TournamentFormat : uint8_t
+    {
+        RoundRobin, // every pair of bots
+        Gauntlet // bots[0] against each of the others
+    };
+
+    struct TournamentConfig
+    {
+        TournamentFormat format{TournamentFormat::RoundRobin};
+        uint32_t deals{1000}; // per pairing; every deal is played twice with seats swapped
+        unsigned threads{0}; // 0 = std::thread::hardware_concurrency()
+        uint64_t seed{20261018ULL};
+        uint8_t deal_up_to{6};
+        bool deck36{true};
+        bool counter_rng{false}; // deals and bot seeds from CounterRng streams of (seed, deal)
+        uint32_t max_plies{5000}; // longer games are scored as draws
+        std::function<std::unique_ptr<DuelObserver>(unsigned worker)> observer{}; // optional, one per worker
+    };
+
+    // Heads-up results of bots[a] against bots[b]. Game counts are from a's side.
+    struct PairStats
+    {
+        uint32_t a{0};
+        uint32_t b{0};
+        uint64_t a_wins{0};
+        uint64_t b_wins{0};
+        uint64_t draws{0};
+        uint64_t a_sweeps{0}; // deals a won from both seats
+        uint64_t b_sweeps{0};
+
+        auto Games() const noexcept -> uint64_t { return a_wins + b_wins + draws; }
+    };
+
+    // Speed numbers: wall-clock, so unlike everything else they vary between runs.
+    struct BotStats
+    {
+        uint64_t decisions{0};
+        uint64_t violations{0}; // rejected actions replaced by Judge::DefaultAction
+        std::chrono::nanoseconds think{0};
+    };
+
+    struct Rating
+    {
+        double elo{0.0}; // relative to bots[0]
+        double ci95{0.0}; // half-width of the 95% interval
+    };
+
+    struct TournamentReport
+    {
+        std::vector<PairStats> pairs;
+        std::vector<BotStats> bots;
+        std::vector<Rating> ratings;
+        uint64_t engine_errors{0}; // games abandoned on an engine error (scored as draws)
+    };
+
+    // Plays every pairing over the same seeded deals, spread over worker threads. Everything except
+    // BotStats::think is a pure function of the bots, the config and the seed, whatever the thread count.
+    auto RunTournament(std::span<BotEntry const> bots, TournamentConfig const& cfg) -> TournamentReport;
+
+    // Bradley-Terry maximum likelihood over the pair results, draws counting half a win each and one
+    // virtual draw per pairing so perfect scores stay finite. Intervals come from the observed information.
+    auto FitBradleyTerry(size_t n_bots, std::span<PairStats const> pairs) -> std::vector<Rating>;
+}
+
+#endif //IDIOTGAME_TOURNAMENT_HPP
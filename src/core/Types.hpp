@@ -5,7 +5,11 @@
 #ifndef IDIOTGAME_TYPES_HPP
 #define IDIOTGAME_TYPES_HPP
 
+// Build with -DDRK_ALLOW_EXCEPTIONS=false (CMake: DURAK_NO_EXCEPTIONS) for an exception-free engine:
+// engine errors then only travel as error::Result and DRK_THROW/DRK_ASSERT abort.
+#ifndef DRK_ALLOW_EXCEPTIONS
 #define DRK_ALLOW_EXCEPTIONS true
+#endif
 #define DRK_ENABLE_TEST_HOOKS true
 
 #include <cstdint>
@@ -21,6 +25,7 @@ namespace durak::core::constants
 {
     inline constexpr size_t MaxTableSlots = 6;
     inline constexpr size_t MaxPlayers = 6;
+    inline constexpr size_t MaxDeckSize = 52;
 }
 
 namespace durak::core
@@ -95,6 +100,8 @@ namespace durak::core
         bool deck36{true};
         uint64_t seed{std::random_device{}()};
         std::chrono::milliseconds turn_timeout{std::chrono::seconds(30ULL)};
+        // Shuffle with CounterRng instead of std::mt19937_64 (same seed, different deal)
+        bool counter_rng{false};
     };
 
     using PlyrIdxT = uint8_t;
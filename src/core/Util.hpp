@@ -37,6 +37,21 @@ namespace durak::core::util
         return static_cast<uint64_t>(c.suit) * 13 + static_cast<uint64_t>(c.rank);
     }
 
+    inline auto UIDToSuit(uint64_t const uid) -> Suit
+    {
+        return static_cast<Suit>(uid / 13);
+    }
+
+    inline auto UIDToRank(uint64_t const uid) -> Rank
+    {
+        return static_cast<Rank>(uid % 13);
+    }
+
+    inline auto UIDToCard(uint64_t const uid) -> Card
+    {
+        return Card{UIDToSuit(uid), UIDToRank(uid)};
+    }
+
     class CardUniqueChecker
     {
     public:
@@ -0,0 +1,126 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_VIOLATIONGATE_HPP
+#define IDIOTGAME_VIOLATIONGATE_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+#include "Types.hpp"
+
+namespace durak::core
+{
+    // Host-side policy for rejected actions.
+    // Each seat gets 'retries' consecutive invalid actions before the host substitutes Judge::DefaultAction.
+    // Violations are counted per seat and code and handed to the host's sink as one summary line at most
+    // every 'log_every'; the gate itself never prints, so where (and on which thread) it lands is up to the host.
+    class ViolationGate
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Sink = std::function<void(std::string_view)>;
+
+        enum class Verdict : uint8_t
+        {
+            Retry, // ask the same seat again
+            Forfeit // budget spent: resolve the default action instead
+        };
+
+        // No sink: summaries are discarded (the counters still work).
+        explicit ViolationGate(std::size_t seats,
+                               Sink sink = {},
+                               uint8_t retries = 3,
+                               std::chrono::milliseconds log_every = std::chrono::seconds(5)) :
+            seats_(seats),
+            sink_(std::move(sink)),
+            retries_(retries),
+            log_every_(log_every)
+        {
+        }
+
+        ViolationGate(ViolationGate const&) = delete;
+        auto operator=(ViolationGate const&) -> ViolationGate& = delete;
+
+        auto OnViolation(PlyrIdxT const seat, error::RuleViolation const& v,
+                         Clock::time_point const now = Clock::now()) -> Verdict
+        {
+            Seat& s = seats_[seat];
+            ++s.total;
+            ++s.pending[static_cast<std::size_t>(v.code)];
+            ++pending_;
+
+            if (now >= next_log_)
+            {
+                Flush();
+                next_log_ = now + log_every_;
+            }
+
+            if (++s.strikes > retries_)
+            {
+                s.strikes = 0;
+                ++s.forfeits;
+                return Verdict::Forfeit;
+            }
+            return Verdict::Retry;
+        }
+
+        // An action from 'seat' was accepted: its retry budget refills.
+        auto OnAccepted(PlyrIdxT const seat) noexcept -> void { seats_[seat].strikes = 0; }
+
+        // Hands everything counted since the last summary to the sink (no-op when nothing is pending).
+        // Not called on destruction: hosts flush when their game ends.
+        auto Flush() -> void
+        {
+            if (pending_ == 0) { return; }
+
+            std::string line = std::format("[violations] {} since last report:", pending_);
+            for (std::size_t i = 0; i < seats_.size(); ++i)
+            {
+                for (std::size_t c = 0; c < CodeCount; ++c)
+                {
+                    if (seats_[i].pending[c] == 0) { continue; }
+                    line += std::format(" P{} {} x{};", i,
+                                        error::to_string(static_cast<error::RuleViolationCode>(c)),
+                                        seats_[i].pending[c]);
+                    seats_[i].pending[c] = 0;
+                }
+            }
+            if (sink_) { sink_(line); }
+            pending_ = 0;
+        }
+
+        auto Total(PlyrIdxT const seat) const noexcept -> uint32_t { return seats_[seat].total; }
+        auto Forfeits(PlyrIdxT const seat) const noexcept -> uint32_t { return seats_[seat].forfeits; }
+
+    private:
+        static constexpr std::size_t CodeCount =
+            static_cast<std::size_t>(error::RuleViolationCode::Internal_Unreachable) + 1;
+
+        struct Seat
+        {
+            uint8_t strikes{0};
+            uint32_t total{0};
+            uint32_t forfeits{0};
+            std::array<uint32_t, CodeCount> pending{};
+        };
+
+        std::vector<Seat> seats_;
+        Sink sink_;
+        uint8_t retries_;
+        std::chrono::milliseconds log_every_;
+        Clock::time_point next_log_{};
+        uint32_t pending_{0};
+    };
+}
+
+#endif //IDIOTGAME_VIOLATIONGATE_HPP
@@ -2,11 +2,13 @@
 
 #include <array>
 #include <format>
-#include <ranges>
+#include <fstream>
 #include <string_view>
+#include <thread>
 #include <vector>
 
-#include "Inspector.hpp" // NEW
+#include "SpscQueue.hpp"
+#include "../core/Util.hpp"
 
 using namespace durak::core;
 
@@ -32,95 +34,150 @@ namespace
         return map[static_cast<size_t>(r)];
     }
 
-    auto s_card(Card const& c) -> std::string
+    auto s_card(std::uint8_t const uid) -> std::string
     {
-        return std::format("{}{}", s_rank(c.rank), s_suit(c.suit));
+        return std::format("{}{}", s_rank(util::UIDToRank(uid)), s_suit(util::UIDToSuit(uid)));
     }
 
-    auto s_action(PlayerAction const& a) -> std::string
+    constexpr std::uint8_t NoCard = 0xFF;
+    constexpr std::uint8_t NoAction = 0xFF;
+
+    auto to_uid(CardWP const& w) -> std::uint8_t
+    {
+        auto const sp = w.lock();
+        return sp ? static_cast<std::uint8_t>(util::CardToUID(*sp)) : NoCard;
+    }
+
+    enum class RecordKind : std::uint8_t
     {
-        return std::visit(
-            [&]<typename T0>(T0 const& act) -> std::string
+        Start,
+        Turn,
+        Outcome,
+        Cleanup,
+        End,
+        Flush,
+        Stop
+    };
+
+    // Fixed-size, trivially copyable: everything the text lines need, as card uids and counts.
+    struct AuditRecord
+    {
+        RecordKind kind{RecordKind::Flush};
+        std::uint8_t actor{0};
+        Phase phase{Phase::Attacking};
+        std::uint8_t atk{0}, def{0};
+        Suit trump{Suit::Spades};
+        std::uint8_t n_players{0};
+        MoveOutcome outcome{MoveOutcome::Invalid};
+        std::uint8_t action_kind{NoAction}; // PlayerAction::index()
+        std::uint8_t action_count{0};
+        std::array<std::uint8_t, 2 * constants::MaxTableSlots> action_cards{};
+        std::array<std::uint8_t, constants::MaxTableSlots> table_atk{};
+        std::array<std::uint8_t, constants::MaxTableSlots> table_def{};
+        std::array<std::uint8_t, constants::MaxPlayers> hands{};
+        std::int8_t loser{-1};
+        std::uint16_t deck{0}, discard{0};
+        std::uint64_t seed{0};
+        std::uint32_t dropped_before{0}; // records lost just ahead of this one
+    };
+
+    auto pack_action(PlayerAction const& a, AuditRecord& r) -> void
+    {
+        r.action_kind = static_cast<std::uint8_t>(a.index());
+        std::visit(
+            [&]<typename T0>(T0 const& act)
             {
                 using T = std::decay_t<T0>;
 
                 if constexpr (std::is_same_v<T, AttackAction>)
                 {
-                    std::vector<std::string> parts;
-                    parts.reserve(act.cards.size());
-
                     for (CardWP const& w : act.cards)
                     {
-                        auto const sp = w.lock();
-                        if (sp)
-                        {
-                            parts.emplace_back(s_card(*sp));
-                        }
+                        if (r.action_count == constants::MaxTableSlots) break;
+                        r.action_cards[r.action_count++] = to_uid(w);
                     }
-
-                    std::string body;
-                    for (size_t i{}; i < parts.size(); ++i)
-                    {
-                        body += (i ? "," : "");
-                        body += parts[i];
-                    }
-                    return std::format("Attack[{}]", body);
                 }
                 else if constexpr (std::is_same_v<T, DefendAction>)
                 {
-                    std::vector<std::string> parts;
-                    parts.reserve(act.pairs.size());
-
                     for (DefendPair const& p : act.pairs)
                     {
-                        auto const a1 = p.attack.lock();
-                        auto const d1 = p.defend.lock();
-                        if (a1 && d1)
-                        {
-                            parts.emplace_back(std::format("{}/{}", s_card(*a1), s_card(*d1)));
-                        }
+                        if (r.action_count == constants::MaxTableSlots) break;
+                        r.action_cards[2 * r.action_count] = to_uid(p.attack);
+                        r.action_cards[2 * r.action_count + 1] = to_uid(p.defend);
+                        ++r.action_count;
                     }
-
-                    std::string body;
-                    for (size_t i{}; i < parts.size(); ++i)
-                    {
-                        body += (i ? "," : "");
-                        body += parts[i];
-                    }
-                    return std::format("Defend{{{}}}", body);
                 }
                 else if constexpr (std::is_same_v<T, TransferAction>)
                 {
-                    if (auto const sp = act.card.lock())
-                    {
-                        return std::format("Transfer({})", s_card(*sp));
-                    }
-                    return "Transfer(?)";
+                    r.action_cards[0] = to_uid(act.card);
+                    r.action_count = 1;
                 }
-                else if constexpr (std::is_same_v<T, PassAction>)
+            },
+            a
+        );
+    }
+
+    auto s_action(AuditRecord const& r) -> std::string
+    {
+        auto join = [](std::vector<std::string> const& parts)
+        {
+            std::string body;
+            for (size_t i{}; i < parts.size(); ++i)
+            {
+                body += (i ? "," : "");
+                body += parts[i];
+            }
+            return body;
+        };
+
+        switch (r.action_kind)
+        {
+        case 0:
+            {
+                std::vector<std::string> parts;
+                for (std::uint8_t i = 0; i < r.action_count; ++i)
                 {
-                    return "Pass";
+                    if (r.action_cards[i] != NoCard) parts.emplace_back(s_card(r.action_cards[i]));
                 }
-                else
+                return std::format("Attack[{}]", join(parts));
+            }
+        case 1:
+            {
+                std::vector<std::string> parts;
+                for (std::uint8_t i = 0; i < r.action_count; ++i)
                 {
-                    return "Take";
+                    std::uint8_t const a1 = r.action_cards[2 * i];
+                    std::uint8_t const d1 = r.action_cards[2 * i + 1];
+                    if (a1 != NoCard && d1 != NoCard)
+                    {
+                        parts.emplace_back(std::format("{}/{}", s_card(a1), s_card(d1)));
+                    }
                 }
-            },
-            a
-        );
+                return std::format("Defend{{{}}}", join(parts));
+            }
+        case 2:
+            return (r.action_cards[0] != NoCard) ? std::format("Transfer({})", s_card(r.action_cards[0]))
+                                                 : std::string("Transfer(?)");
+        case 3:
+            return "Pass";
+        case 4:
+            return "Take";
+        default:
+            return "<omitted>";
+        }
     }
 
-    auto serialize_table(GameSnapshot const& s) -> std::string
+    auto serialize_table(AuditRecord const& r) -> std::string
     {
         std::string serial;
         bool first = true;
 
-        for (TableSlotView const& slot : s.table)
+        for (size_t i{}; i < constants::MaxTableSlots; ++i)
         {
-            auto const a1 = slot.attack.lock();
-            auto const d1 = slot.defend.lock();
+            std::uint8_t const a1 = r.table_atk[i];
+            std::uint8_t const d1 = r.table_def[i];
 
-            if (!a1 && !d1)
+            if (a1 == NoCard && d1 == NoCard)
             {
                 continue;
             }
@@ -130,30 +187,195 @@ namespace
 
             serial += std::format(
                 "{}/{}",
-                a1 ? s_card(*a1) : std::string("--"),
-                d1 ? s_card(*d1) : std::string("--")
+                a1 != NoCard ? s_card(a1) : std::string("--"),
+                d1 != NoCard ? s_card(d1) : std::string("--")
             );
         }
 
         return serial;
     }
+
+    auto format_record(AuditRecord const& r, std::string& out) -> void
+    {
+        if (r.dropped_before != 0) out += std::format("Dropped={}\n", r.dropped_before);
+
+        switch (r.kind)
+        {
+        case RecordKind::Start:
+            out += std::format("Seed={}\n", r.seed);
+            out += std::format("Trump={}\n", s_suit(r.trump));
+            out += std::format("Players={}\n", static_cast<int>(r.n_players));
+            break;
+        case RecordKind::Turn:
+            out += std::format(
+                "Turn actor=P{} phase={} atk={} def={} table=[{}] deck={} discard={}\n",
+                static_cast<int>(r.actor),
+                (r.phase == Phase::Attacking ? "A" : "D"),
+                static_cast<int>(r.atk),
+                static_cast<int>(r.def),
+                serialize_table(r),
+                r.deck,
+                r.discard
+            );
+            out += std::format("Action: {}\n", s_action(r));
+            break;
+        case RecordKind::Outcome:
+            {
+                char const* txt =
+                (r.outcome == MoveOutcome::Applied
+                     ? "Applied"
+                     : (r.outcome == MoveOutcome::RoundEnded
+                            ? "RoundEnded"
+                            : (r.outcome == MoveOutcome::GameEnded ? "GameEnded" : "Invalid")));
+                out += std::format("Outcome: {}\n", txt);
+                break;
+            }
+        case RecordKind::Cleanup:
+            {
+                std::string body;
+                for (std::uint8_t i = 0; i < r.n_players; ++i)
+                {
+                    body += std::format("{}{}:{}", (i ? "," : ""), static_cast<int>(i), static_cast<int>(r.hands[i]));
+                }
+                out += std::format(
+                    "Cleanup: handsizes=[{}] next_atk=P{} next_def=P{} deck={} discard={}\n",
+                    body,
+                    static_cast<int>(r.atk),
+                    static_cast<int>(r.def),
+                    r.deck,
+                    r.discard
+                );
+                break;
+            }
+        case RecordKind::End:
+            out += std::format("Loser={}\n", static_cast<int>(r.loser));
+            break;
+        case RecordKind::Flush:
+        case RecordKind::Stop:
+            break;
+        }
+    }
+
+    auto turn_record(GameImpl const& game, GameSnapshot const& s, std::uint8_t actor) -> AuditRecord
+    {
+        AuditRecord r{};
+        r.kind = RecordKind::Turn;
+        r.actor = actor;
+        r.phase = s.phase;
+        r.atk = s.attacker_idx;
+        r.def = s.defender_idx;
+        for (size_t i{}; i < constants::MaxTableSlots; ++i)
+        {
+            r.table_atk[i] = to_uid(s.table[i].attack);
+            r.table_def[i] = to_uid(s.table[i].defend);
+        }
+        r.deck = static_cast<std::uint16_t>(game.DeckSize());
+        r.discard = static_cast<std::uint16_t>(game.DiscardSize());
+        return r;
+    }
 } // anonymous namespace
 
 namespace durak::core::debug
 {
-    AuditLogger::AuditLogger(std::string path)
-        : out_(std::move(path), std::ios::out | std::ios::trunc)
+    struct AuditLogger::Backend
+    {
+        static constexpr std::size_t QueueCapacity = 1024;
+        static constexpr std::size_t BatchSize = 128;
+
+        explicit Backend(std::string path) :
+            out(std::move(path), std::ios::out | std::ios::trunc),
+            writer([this] { Run(); })
+        {
+        }
+
+        ~Backend()
+        {
+            // The stop marker must get through (it also carries any trailing drop count)
+            AuditRecord stop{.kind = RecordKind::Stop};
+            stop.dropped_before = pending_drops;
+            while (!queue.TryPush(stop))
+            {
+                queue.Notify();
+                std::this_thread::yield();
+            }
+            queue.Notify();
+            writer.join();
+        }
+
+        // Game thread, never blocks: a record that finds the queue full is dropped and counted,
+        // and the next one that fits carries the count.
+        auto Push(AuditRecord r) -> void
+        {
+            r.dropped_before = pending_drops;
+            if (queue.TryPush(r))
+            {
+                pending_drops = 0;
+            }
+            else
+            {
+                ++pending_drops;
+                ++dropped;
+            }
+            queue.Notify();
+        }
+
+        auto Run() -> void
+        {
+            std::array<AuditRecord, BatchSize> batch{};
+            std::string text;
+            std::size_t seen = 0;
+
+            for (;;)
+            {
+                std::size_t const n = queue.PopBatch(batch);
+                if (n == 0)
+                {
+                    queue.WaitForData(seen);
+                    continue;
+                }
+                seen += n;
+
+                bool flush_now = false;
+                bool stop = false;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    format_record(batch[i], text);
+                    flush_now |= (batch[i].kind == RecordKind::Flush || batch[i].kind == RecordKind::End ||
+                                  batch[i].kind == RecordKind::Start);
+                    stop |= (batch[i].kind == RecordKind::Stop);
+                }
+
+                out.write(text.data(), static_cast<std::streamsize>(text.size()));
+                text.clear();
+                if (flush_now || stop) { out.flush(); }
+                if (stop) { return; }
+            }
+        }
+
+        std::ofstream out;
+        SpscQueue<AuditRecord, QueueCapacity> queue;
+        std::uint32_t pending_drops{0}; // game thread only
+        std::uint64_t dropped{0};
+        std::thread writer;
+    };
+
+    AuditLogger::AuditLogger(std::string path) :
+        impl_(std::make_unique<Backend>(std::move(path)))
     {
     }
 
     AuditLogger::~AuditLogger() = default;
+    AuditLogger::AuditLogger(AuditLogger&&) noexcept = default;
+    auto AuditLogger::operator=(AuditLogger&&) noexcept -> AuditLogger& = default;
 
     auto AuditLogger::start(GameImpl const& game, uint64_t seed) -> void
     {
-        out_ << std::format("Seed={}\n", seed);
-        out_ << std::format("Trump={}\n", s_suit(game.Trump()));
-        out_ << std::format("Players={}\n", static_cast<int>(game.PlayerCount()));
-        out_.flush();
+        impl_->Push(AuditRecord{
+            .kind = RecordKind::Start,
+            .trump = game.Trump(),
+            .n_players = static_cast<std::uint8_t>(game.PlayerCount()),
+            .seed = seed
+        });
     }
 
     auto AuditLogger::turn(GameImpl const& game,
@@ -161,94 +383,65 @@ namespace durak::core::debug
                            uint8_t actor,
                            PlayerAction const& a) -> void
     {
-        auto const snap = Inspector::Gather(game);
-        out_ << std::format(
-            "Turn actor=P{} phase={} atk={} def={} table=[{}] deck={} discard={}\n",
-            static_cast<int>(actor),
-            (s.phase == Phase::Attacking ? "A" : "D"),
-            static_cast<int>(s.attacker_idx),
-            static_cast<int>(s.defender_idx),
-            serialize_table(s),
-            snap.deck.size(),
-            snap.discard.size()
-        );
-
-        out_ << std::format("Action: {}\n", s_action(a));
+        AuditRecord r = turn_record(game, s, actor);
+        pack_action(a, r);
+        impl_->Push(r);
     }
 
     auto AuditLogger::turn(GameImpl const& game,
                            GameSnapshot const& s,
                            uint8_t actor) -> void
     {
-        auto const snap = Inspector::Gather(game);
-        out_ << std::format(
-            "Turn actor=P{} phase={} atk={} def={} table=[{}] deck={} discard={}\n",
-            static_cast<int>(actor),
-            (s.phase == Phase::Attacking ? "A" : "D"),
-            static_cast<int>(s.attacker_idx),
-            static_cast<int>(s.defender_idx),
-            serialize_table(s),
-            snap.deck.size(),
-            snap.discard.size()
-        );
-
-        out_ << "Action: <omitted>\n";
+        impl_->Push(turn_record(game, s, actor));
     }
 
     auto AuditLogger::outcome(MoveOutcome m) -> void
     {
-        char const* txt =
-        (m == MoveOutcome::Applied
-             ? "Applied"
-             : (m == MoveOutcome::RoundEnded ? "RoundEnded" : (m == MoveOutcome::GameEnded ? "GameEnded" : "Invalid")));
-        out_ << std::format("Outcome: {}\n", txt);
+        impl_->Push(AuditRecord{.kind = RecordKind::Outcome, .outcome = m});
     }
 
     auto AuditLogger::cleanup(GameImpl const& game) -> void
     {
-        std::string body;
+        DRK_ASSERT(game.PlayerCount() <= constants::MaxPlayers, "AuditLogger: too many seats");
 
-        for (std::uint8_t i = 0; i < game.PlayerCount(); ++i)
+        AuditRecord r{};
+        r.kind = RecordKind::Cleanup;
+        r.n_players = static_cast<std::uint8_t>(game.PlayerCount());
+        for (std::uint8_t i = 0; i < r.n_players; ++i)
         {
-            auto const snap = game.SnapshotFor(i);
-            body += std::format(
-                "{}{}:{}",
-                (i ? "," : ""),
-                static_cast<int>(i),
-                snap->my_hand.size()
-            );
+            r.hands[i] = static_cast<std::uint8_t>(game.HandSize(i));
         }
-
-        auto const snap = Inspector::Gather(game);
-
-        out_ << std::format(
-            "Cleanup: handsizes=[{}] next_atk=P{} next_def=P{} deck={} discard={}\n",
-            body,
-            static_cast<int>(game.Attacker()),
-            static_cast<int>(game.Defender()),
-            snap.deck.size(),
-            snap.discard.size()
-        );
+        r.atk = game.Attacker();
+        r.def = game.Defender();
+        r.deck = static_cast<std::uint16_t>(game.DeckSize());
+        r.discard = static_cast<std::uint16_t>(game.DiscardSize());
+        impl_->Push(r);
     }
 
     auto AuditLogger::end(GameImpl const& game) -> void
     {
-        int loser = -1;
+        AuditRecord r{};
+        r.kind = RecordKind::End;
 
         for (uint8_t i = 0; i < game.PlayerCount(); ++i)
         {
-            auto const snap = game.SnapshotFor(i);
-            loser = (loser == -1 && !snap->my_hand.empty())
-                        ? static_cast<int>(i)
-                        : loser;
+            if (game.HandSize(i) != 0)
+            {
+                r.loser = static_cast<std::int8_t>(i);
+                break;
+            }
         }
 
-        out_ << std::format("Loser={}\n", loser);
-        out_.flush();
+        impl_->Push(r);
     }
 
     auto AuditLogger::flush() -> void
     {
-        out_.flush();
+        impl_->Push(AuditRecord{.kind = RecordKind::Flush});
+    }
+
+    auto AuditLogger::dropped() const noexcept -> std::uint64_t
+    {
+        return impl_->dropped;
     }
-} // namespace durak::core::debug
\ No newline at end of file
+} // namespace durak::core::debug
@@ -6,7 +6,7 @@
 #define IDIOTGAME_AUDITLOGGER_HPP
 
 #include <cstdint>
-#include <fstream>
+#include <memory>
 #include <string>
 
 #include "../core/Game.hpp"
@@ -16,6 +16,10 @@
 
 namespace durak::core::debug
 {
+    // Game-thread calls only pack a fixed-size record into a lock-free queue;
+    // a background writer formats the text and flushes it in batches.
+    // The game thread never waits on the writer: records that find the queue full are dropped,
+    // counted, and reported in the log as a Dropped=N line where the gap is.
     class AuditLogger
     {
     public:
@@ -25,8 +29,8 @@ namespace durak::core::debug
         AuditLogger(AuditLogger const&) = delete;
         auto operator=(AuditLogger const&) -> AuditLogger& = delete;
 
-        AuditLogger(AuditLogger&&) noexcept = default;
-        auto operator=(AuditLogger&&) noexcept -> AuditLogger& = default;
+        AuditLogger(AuditLogger&&) noexcept;
+        auto operator=(AuditLogger&&) noexcept -> AuditLogger&;
 
         // Session header (seed, trump, player count)
         auto start(GameImpl const& game, std::uint64_t seed) -> void;
@@ -52,11 +56,16 @@ namespace durak::core::debug
         // Game end footer (loser seat; -1 if none)
         auto end(GameImpl const& game) -> void;
 
-        // Manual flush
+        // Ask the writer to flush once it reaches this point (does not block).
+        // Everything queued is always written by the destructor.
         auto flush() -> void;
 
+        // Records lost so far because the writer was a full queue behind.
+        auto dropped() const noexcept -> std::uint64_t;
+
     private:
-        std::ofstream out_;
+        struct Backend;
+        std::unique_ptr<Backend> impl_;
     };
 }
 
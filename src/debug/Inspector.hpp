@@ -38,15 +38,15 @@ namespace durak::core::debug
         {
             SnapshotAll ret{};
             ret.trump = g.trump_;
-            ret.n_players = static_cast<uint8_t>(g.players_.size());
+            ret.n_players = g.seats_;
             ret.phase = g.phase_;
             ret.attacker_idx = g.attacker_idx_;
             ret.defender_idx = g.defender_idx_;
-            ret.hands.resize(g.players_.size());
+            ret.hands.resize(g.seats_);
 
             ret.max_deck_size = g.cfg_.deck36 ? 36 : 52;
 
-            for (size_t i{}; i < g.hands_.size(); ++i)
+            for (size_t i{}; i < g.seats_; ++i)
             {
                 std::vector<CardSP> const& src = g.hands_[i];
                 std::vector<Card const*>& dst = ret.hands[i];
@@ -71,6 +71,9 @@ namespace durak::core::debug
 
             return ret;
         }
+
+        // The live zone masks, writable: for tests that corrupt a game on purpose.
+        static inline auto MasksOf(GameImpl& g) -> ZoneMasks& { return g.masks_; }
     };
 }
 
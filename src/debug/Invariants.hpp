@@ -5,12 +5,17 @@
 #ifndef IDIOTGAME_INVARIANTS_HPP
 #define IDIOTGAME_INVARIANTS_HPP
 
+#include "../core/CardMasks.hpp"
 #include "../core/Game.hpp"
 #include "Inspector.hpp"
 #include <cassert>
 #include <ranges>
 #include <array>
+#include <bit>
+#include <cstdint>
+#include <string_view>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace durak::core::debug
@@ -102,5 +107,133 @@ namespace durak::core::debug
 
 #endif // DRK_ENABLE_TEST_HOOKS == true
     }
+
+    enum class InvariantFault : uint8_t
+    {
+        None,
+        ZoneSizeMismatch, // a zone mask disagrees with its container (duplicate/lost card)
+        CardsOverlap, // the same card in two zones
+        CardsMissing, // zones do not add up to the full deck
+        DefendWithoutAttack,
+        AttackCapExceeded,
+        UncoveredExceedsHand, // defender cannot possibly cover what is on the table
+        DefendingWithoutUncovered,
+        AttackingWithUncovered,
+        BadRoles,
+        TableRanksStale // the rank summary disagrees with the cards on the table
+    };
+
+    constexpr auto to_string(InvariantFault const f) -> std::string_view
+    {
+        switch (f)
+        {
+        case InvariantFault::None: return "None";
+        case InvariantFault::ZoneSizeMismatch: return "ZoneSizeMismatch";
+        case InvariantFault::CardsOverlap: return "CardsOverlap";
+        case InvariantFault::CardsMissing: return "CardsMissing";
+        case InvariantFault::DefendWithoutAttack: return "DefendWithoutAttack";
+        case InvariantFault::AttackCapExceeded: return "AttackCapExceeded";
+        case InvariantFault::UncoveredExceedsHand: return "UncoveredExceedsHand";
+        case InvariantFault::DefendingWithoutUncovered: return "DefendingWithoutUncovered";
+        case InvariantFault::AttackingWithUncovered: return "AttackingWithUncovered";
+        case InvariantFault::BadRoles: return "BadRoles";
+        case InvariantFault::TableRanksStale: return "TableRanksStale";
+        }
+        return "?";
+    }
+
+    constexpr auto FullDeckMask(bool const deck36) -> uint64_t
+    {
+        uint64_t const per_suit = deck36 ? (uint64_t{0x1FF} << static_cast<unsigned>(Rank::Six)) : uint64_t{0x1FFF};
+        return per_suit | (per_suit << 13) | (per_suit << 26) | (per_suit << 39);
+    }
+
+    // Same guarantees as CheckInvariants (plus cap/role checks) from GameImpl's zone masks:
+    // no allocation, a few popcounts and ands. Cheap enough to leave on in production.
+    inline auto CheckInvariantsFast(GameImpl const& g) noexcept -> InvariantFault
+    {
+        ZoneMasks const& m = g.Masks();
+        size_t const n = g.PlayerCount();
+
+        // Conservation: each zone mask matches its container, zones are disjoint and cover the deck
+        uint64_t seen = m.deck;
+        uint64_t overlap = 0;
+        int total = std::popcount(m.deck);
+        auto add = [&](uint64_t const zone)
+        {
+            overlap |= seen & zone;
+            seen |= zone;
+            total += std::popcount(zone);
+        };
+        add(m.discard);
+        add(m.table);
+        for (size_t s = 0; s < n; ++s) add(m.hands[s]);
+
+        bool sizes_ok = std::cmp_equal(std::popcount(m.deck), g.DeckSize()) &&
+                        std::cmp_equal(std::popcount(m.discard), g.DiscardSize()) &&
+                        std::popcount(m.table) == std::popcount(m.atk_slots) + std::popcount(m.def_slots);
+        for (size_t s = 0; s < n; ++s)
+        {
+            sizes_ok &= std::cmp_equal(std::popcount(m.hands[s]), g.HandSize(static_cast<PlyrIdxT>(s)));
+        }
+        if (!sizes_ok) return InvariantFault::ZoneSizeMismatch;
+        if (overlap != 0) return InvariantFault::CardsOverlap;
+
+        uint64_t const full = FullDeckMask(g.Cfg().deck36);
+        if (seen != full || total != std::popcount(full)) return InvariantFault::CardsMissing;
+
+        // Table shape
+        if ((m.def_slots & ~m.atk_slots) != 0) return InvariantFault::DefendWithoutAttack;
+        if (masks::RanksOf(m.table) != m.table_ranks) return InvariantFault::TableRanksStale;
+
+        int const attacks = std::popcount(m.atk_slots);
+        if (attacks > g.BoutCap() || g.BoutCap() > constants::MaxTableSlots) return InvariantFault::AttackCapExceeded;
+
+        PlyrIdxT const atk = g.Attacker();
+        PlyrIdxT const def = g.Defender();
+        size_t live = 0;
+        for (size_t s = 0; s < n; ++s) live += (m.hands[s] != 0);
+        // Once only one seat holds cards the game is over and roles may collapse onto it
+        if (atk >= n || def >= n || (atk == def && live > 1)) return InvariantFault::BadRoles;
+
+        auto const uncovered = static_cast<uint8_t>(m.atk_slots & ~m.def_slots);
+        if (std::cmp_greater(std::popcount(uncovered), g.HandSize(def))) return InvariantFault::UncoveredExceedsHand;
+
+        // Phase: defender only ever faces uncovered attacks; attacker only acts on a fully covered table
+        if (g.PhaseNow() == Phase::Defending && uncovered == 0) return InvariantFault::DefendingWithoutUncovered;
+        if (g.PhaseNow() != Phase::Defending && uncovered != 0) return InvariantFault::AttackingWithUncovered;
+
+        return InvariantFault::None;
+    }
+
+    // Runs CheckInvariantsFast on every Nth OnStep() call (N = 1 checks every step).
+    class InvariantSampler
+    {
+    public:
+        explicit InvariantSampler(uint32_t const every = 1) noexcept :
+            every_(every == 0 ? 1 : every), countdown_(every_)
+        {
+        }
+
+        // Returns the fault found, or None when clean or not sampled this step.
+        auto OnStep(GameImpl const& g) noexcept -> InvariantFault
+        {
+            if (--countdown_ != 0) return InvariantFault::None;
+            countdown_ = every_;
+            ++checks_;
+            InvariantFault const f = CheckInvariantsFast(g);
+            faults_ += (f != InvariantFault::None);
+            return f;
+        }
+
+        auto Checks() const noexcept -> uint64_t { return checks_; }
+        auto Faults() const noexcept -> uint64_t { return faults_; }
+
+    private:
+        uint32_t every_;
+        uint32_t countdown_;
+        uint64_t checks_{0};
+        uint64_t faults_{0};
+    };
 }
 #endif //IDIOTGAME_INVARIANTS_HPP
\ No newline at end of file
@@ -0,0 +1,202 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "ReplayEngine.hpp"
+
+#include <format>
+#include <utility>
+
+#include "../core/ClassicRules.hpp"
+#include "../core/Util.hpp"
+
+namespace durak::core::debug
+{
+    namespace
+    {
+        auto MakeRules(ReplayRules const id, Config const& cfg) -> std::unique_ptr<Rules>
+        {
+            switch (id)
+            {
+            case ReplayRules::Classic:
+                return MakeClassicRules(cfg);
+            }
+            return {};
+        }
+
+        auto Diverged(std::size_t step, std::string what) -> std::unexpected<ReplayError>
+        {
+            return std::unexpected(ReplayError{step, std::format("step {}: {}", step, what)});
+        }
+    }
+
+    ReplayEngine::ReplayEngine(ReplayGame game, std::size_t const checkpoint_every) :
+        game_(std::move(game)),
+        every_(checkpoint_every == 0 ? 1 : checkpoint_every),
+        state_(std::make_unique<GameImpl>(game_.header.config, MakeRules(game_.header.rules, game_.header.config)))
+    {
+    }
+
+    auto ReplayEngine::Create(ReplayGame game, std::size_t const checkpoint_every)
+        -> std::expected<ReplayEngine, ReplayError>
+    {
+        if (!MakeRules(game.header.rules, game.header.config))
+        {
+            return std::unexpected(ReplayError{0, "unknown rules id"});
+        }
+
+        ReplayEngine eng(std::move(game), checkpoint_every);
+        eng.checkpoints_.push_back(eng.state_->Capture());
+
+        while (eng.pos_ < eng.StepCount())
+        {
+            if (auto const out = eng.StepForward(); !out.has_value())
+            {
+                return std::unexpected(out.error());
+            }
+        }
+        return eng;
+    }
+
+    auto ReplayEngine::ApplyRecord(ReplayRecord const& r) -> std::expected<MoveOutcome, ReplayError>
+    {
+        GameImpl& g = *state_;
+        if (r.actor != g.CurrentActor())
+        {
+            return Diverged(pos_, std::format("recorded actor {} but seat {} is to act",
+                                              static_cast<int>(r.actor), static_cast<int>(g.CurrentActor())));
+        }
+
+        auto card_of = [](std::uint8_t const id) { return Card{util::UIDToSuit(id), util::UIDToRank(id)}; };
+        auto from_hand = [&](std::uint8_t const id) -> CardWP
+        {
+            return (id == ReplayNoCard) ? CardWP{} : g.FindFromHand(r.actor, card_of(id));
+        };
+        auto from_table = [&](std::uint8_t const id) -> CardWP
+        {
+            return (id == ReplayNoCard) ? CardWP{} : g.FindFromAtkTable(card_of(id));
+        };
+
+        PlayerAction action{PassAction{}};
+        switch (r.kind)
+        {
+        case 0:
+            {
+                AttackAction a{};
+                for (std::size_t i = 0; i < r.count; ++i) a.cards.push_back(from_hand(r.cards[i]));
+                action = std::move(a);
+                break;
+            }
+        case 1:
+            {
+                DefendAction d{};
+                for (std::size_t i = 0; i < r.count; ++i)
+                {
+                    d.pairs.push_back(DefendPair{from_table(r.cards[2 * i]), from_hand(r.cards[2 * i + 1])});
+                }
+                action = std::move(d);
+                break;
+            }
+        case 2:
+            action = TransferAction{from_hand(r.cards[0])};
+            break;
+        case 3:
+            action = PassAction{};
+            break;
+        case 4:
+            action = TakeAction{};
+            break;
+        default:
+            return Diverged(pos_, "bad action kind");
+        }
+
+        auto const out = g.TryResolve(action);
+        if (!out) { return Diverged(pos_, std::format("engine error: {}", out.error().msg)); }
+        return *out;
+    }
+
+    auto ReplayEngine::StepForward() -> std::expected<MoveOutcome, ReplayError>
+    {
+        if (pos_ >= StepCount())
+        {
+            return std::unexpected(ReplayError{pos_, "already at end of recording"});
+        }
+        if (pos_ > 0 && game_.records[pos_ - 1].outcome == MoveOutcome::GameEnded)
+        {
+            return Diverged(pos_, "record after GameEnded");
+        }
+
+        ReplayRecord const& r = game_.records[pos_];
+        auto const out = ApplyRecord(r);
+        if (!out.has_value()) { return out; }
+        if (*out != r.outcome)
+        {
+            return Diverged(pos_, std::format("outcome {} but recorded {}",
+                                              static_cast<int>(*out), static_cast<int>(r.outcome)));
+        }
+
+        ++pos_;
+        if (pos_ % every_ == 0 && pos_ / every_ == checkpoints_.size())
+        {
+            checkpoints_.push_back(state_->Capture());
+        }
+        return out;
+    }
+
+    auto ReplayEngine::SeekTo(std::size_t const n) -> std::expected<void, ReplayError>
+    {
+        if (n > StepCount())
+        {
+            return std::unexpected(ReplayError{n, "seek past end of recording"});
+        }
+
+        // Nearest checkpoint at or before n; only restore if the current position can't get there sooner.
+        std::size_t const k = std::min(n / every_, checkpoints_.size() - 1);
+        std::size_t const base = k * every_;
+        if (pos_ > n || pos_ < base)
+        {
+            state_->Restore(checkpoints_[k]);
+            pos_ = base;
+        }
+
+        while (pos_ < n)
+        {
+            if (auto const out = StepForward(); !out.has_value())
+            {
+                return std::unexpected(out.error());
+            }
+        }
+        return {};
+    }
+
+    auto ReplayEngine::Verify() -> std::expected<void, ReplayError>
+    {
+        if (auto const ok = SeekTo(StepCount()); !ok.has_value())
+        {
+            return ok;
+        }
+        if (!game_.complete)
+        {
+            return std::unexpected(ReplayError{pos_, "recording has no end record (aborted or truncated)"});
+        }
+        if (game_.records.empty() || game_.records.back().outcome != MoveOutcome::GameEnded)
+        {
+            return std::unexpected(ReplayError{pos_, "recording ends before GameEnded"});
+        }
+
+        std::optional<PlyrIdxT> loser{};
+        for (PlyrIdxT seat = 0; seat < state_->PlayerCount(); ++seat)
+        {
+            if (state_->HandSize(seat) != 0)
+            {
+                loser = seat;
+                break;
+            }
+        }
+        if (loser != game_.loser)
+        {
+            return std::unexpected(ReplayError{pos_, "final hands do not match recorded loser"});
+        }
+        return {};
+    }
+}
@@ -0,0 +1,57 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_REPLAYENGINE_HPP
+#define IDIOTGAME_REPLAYENGINE_HPP
+
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <vector>
+
+#include "../core/Game.hpp"
+#include "ReplayLog.hpp"
+
+namespace durak::core::debug
+{
+    // Re-executes a recorded game through its rules (no players, no Judge).
+    // A StateImage is kept every 'checkpoint_every' records, so SeekTo(n) replays at most that many steps.
+    class ReplayEngine
+    {
+    public:
+        // Runs the whole game once to build checkpoints; fails if the replay diverges from the recording.
+        static auto Create(ReplayGame game, std::size_t checkpoint_every = 32)
+            -> std::expected<ReplayEngine, ReplayError>;
+
+        ReplayEngine(ReplayEngine&&) noexcept = default;
+        auto operator=(ReplayEngine&&) noexcept -> ReplayEngine& = default;
+
+        auto StepCount() const noexcept -> std::size_t { return game_.records.size(); }
+        // Number of records applied to State()
+        auto Position() const noexcept -> std::size_t { return pos_; }
+
+        // Moves to the state after the first 'n' records.
+        auto SeekTo(std::size_t n) -> std::expected<void, ReplayError>;
+        auto StepForward() -> std::expected<MoveOutcome, ReplayError>;
+
+        // Checks the final state against the recording: outcome of the last step and the loser seat.
+        auto Verify() -> std::expected<void, ReplayError>;
+
+        auto State() const noexcept -> GameImpl const& { return *state_; }
+        auto Recording() const noexcept -> ReplayGame const& { return game_; }
+
+    private:
+        ReplayEngine(ReplayGame game, std::size_t checkpoint_every);
+
+        auto ApplyRecord(ReplayRecord const& r) -> std::expected<MoveOutcome, ReplayError>;
+
+        ReplayGame game_;
+        std::size_t every_;
+        std::unique_ptr<GameImpl> state_;
+        std::size_t pos_{0};
+        std::vector<StateImage> checkpoints_; // checkpoints_[k] = state after k * every_ records
+    };
+}
+
+#endif //IDIOTGAME_REPLAYENGINE_HPP
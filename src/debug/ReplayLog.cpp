@@ -0,0 +1,405 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "ReplayLog.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "../core/Util.hpp"
+
+namespace durak::core::debug
+{
+    namespace
+    {
+        constexpr std::array<std::uint8_t, 4> Magic{'D', 'R', 'K', 'R'};
+
+        auto PutVarint(std::vector<std::uint8_t>& out, std::uint64_t v) -> void
+        {
+            while (v >= 0x80)
+            {
+                out.push_back(static_cast<std::uint8_t>(v | 0x80));
+                v >>= 7;
+            }
+            out.push_back(static_cast<std::uint8_t>(v));
+        }
+
+        auto UidOf(CardWP const& w) -> std::uint8_t
+        {
+            CardSP const sp = w.lock();
+            return sp ? static_cast<std::uint8_t>(util::CardToUID(*sp)) : ReplayNoCard;
+        }
+
+        auto MakeTag(std::uint8_t kind, MoveOutcome outcome, PlyrIdxT actor) -> std::uint8_t
+        {
+            return static_cast<std::uint8_t>((kind & 0x7u) |
+                                             ((static_cast<std::uint8_t>(outcome) & 0x3u) << 3) |
+                                             ((actor & 0x7u) << 5));
+        }
+
+        class Cursor
+        {
+        public:
+            Cursor(std::span<std::uint8_t const> bytes, std::size_t pos) : bytes_(bytes), pos_(pos) {}
+
+            auto Pos() const noexcept -> std::size_t { return pos_; }
+            auto AtEnd() const noexcept -> bool { return pos_ >= bytes_.size(); }
+
+            auto U8(std::uint8_t& out) -> bool
+            {
+                if (pos_ >= bytes_.size()) { return false; }
+                out = bytes_[pos_++];
+                return true;
+            }
+
+            auto Varint(std::uint64_t& out) -> bool
+            {
+                out = 0;
+                for (unsigned shift = 0; shift < 64; shift += 7)
+                {
+                    std::uint8_t b{};
+                    if (!U8(b)) { return false; }
+                    out |= static_cast<std::uint64_t>(b & 0x7Fu) << shift;
+                    if ((b & 0x80u) == 0) { return true; }
+                }
+                return false;
+            }
+
+            auto Bytes(std::uint8_t* dst, std::size_t n) -> bool
+            {
+                if (bytes_.size() - pos_ < n) { return false; }
+                std::memcpy(dst, bytes_.data() + pos_, n);
+                pos_ += n;
+                return true;
+            }
+
+        private:
+            std::span<std::uint8_t const> bytes_;
+            std::size_t pos_;
+        };
+
+        auto Fail(Cursor const& c, char const* what) -> std::unexpected<ReplayError>
+        {
+            return std::unexpected(ReplayError{c.Pos(), what});
+        }
+    }
+
+    // ---------------- Writer ----------------
+
+    ReplayWriter::ReplayWriter(std::string const& path) :
+        out_(path, std::ios::binary | std::ios::app)
+    {
+        DRK_ASSERT(out_.is_open(), "ReplayWriter: failed to open file");
+        buf_.reserve(512);
+    }
+
+    ReplayWriter::~ReplayWriter()
+    {
+        Abort();
+        Flush();
+    }
+
+    auto ReplayWriter::Begin(Config const& cfg,
+                             ReplayRules const rules,
+                             std::span<ReplayPlayerKind const> players) -> void
+    {
+        DRK_ASSERT(cfg.n_players == players.size(), "ReplayWriter: player kinds do not match n_players");
+        DRK_ASSERT(cfg.n_players <= 7, "ReplayWriter: actor field holds at most 7 seats");
+
+        buf_.insert(buf_.end(), Magic.begin(), Magic.end());
+        buf_.push_back(ReplayVersion);
+        buf_.push_back(static_cast<std::uint8_t>(rules));
+        buf_.push_back(static_cast<std::uint8_t>(cfg.n_players));
+        buf_.push_back(cfg.deal_up_to);
+        buf_.push_back(static_cast<std::uint8_t>((cfg.deck36 ? 1 : 0) | (cfg.counter_rng ? 2 : 0)));
+        PutVarint(buf_, cfg.seed);
+        PutVarint(buf_, static_cast<std::uint64_t>(cfg.turn_timeout.count()));
+        for (ReplayPlayerKind const k : players)
+        {
+            buf_.push_back(static_cast<std::uint8_t>(k));
+        }
+        records_ = 0;
+        open_ = true;
+    }
+
+    auto ReplayWriter::Record(GameImpl const& game, MoveOutcome const outcome) -> void
+    {
+        Record(game.LastActor(), game.LastAction(), outcome);
+    }
+
+    auto ReplayWriter::Record(PlyrIdxT const actor, PlayerAction const& action, MoveOutcome const outcome) -> void
+    {
+        buf_.push_back(MakeTag(static_cast<std::uint8_t>(action.index()), outcome, actor));
+
+        std::visit([&](auto const& a)
+        {
+            using T = std::decay_t<decltype(a)>;
+            if constexpr (std::is_same_v<T, AttackAction>)
+            {
+                std::size_t const n = std::min(a.cards.size(), constants::MaxTableSlots);
+                buf_.push_back(static_cast<std::uint8_t>(n));
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    buf_.push_back(UidOf(a.cards[i]));
+                }
+            }
+            else if constexpr (std::is_same_v<T, DefendAction>)
+            {
+                std::size_t const n = std::min(a.pairs.size(), constants::MaxTableSlots);
+                buf_.push_back(static_cast<std::uint8_t>(n));
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    buf_.push_back(UidOf(a.pairs[i].attack));
+                    buf_.push_back(UidOf(a.pairs[i].defend));
+                }
+            }
+            else if constexpr (std::is_same_v<T, TransferAction>)
+            {
+                buf_.push_back(UidOf(a.card));
+            }
+        }, action);
+
+        ++records_;
+    }
+
+    auto ReplayWriter::End(GameImpl const& game) -> void
+    {
+        std::optional<PlyrIdxT> loser{};
+        for (PlyrIdxT seat = 0; seat < game.PlayerCount(); ++seat)
+        {
+            if (game.HandSize(seat) != 0)
+            {
+                loser = seat;
+                break;
+            }
+        }
+        End(loser);
+    }
+
+    auto ReplayWriter::End(std::optional<PlyrIdxT> const loser) -> void
+    {
+        buf_.push_back(ReplayEndTag);
+        buf_.push_back(loser.value_or(ReplayNoSeat));
+        PutVarint(buf_, records_);
+        open_ = false;
+        Flush();
+    }
+
+    auto ReplayWriter::Abort() -> void
+    {
+        if (!open_) { return; }
+        buf_.push_back(ReplayEndTag);
+        buf_.push_back(ReplayAborted);
+        PutVarint(buf_, records_);
+        open_ = false;
+        Flush();
+    }
+
+    auto ReplayWriter::Flush() -> void
+    {
+        if (buf_.empty()) { return; }
+        out_.write(reinterpret_cast<char const*>(buf_.data()), static_cast<std::streamsize>(buf_.size()));
+        out_.flush();
+        buf_.clear();
+    }
+
+    // ---------------- Mapping ----------------
+
+    MappedFile::~MappedFile()
+    {
+        Release();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept :
+        data_(std::exchange(other.data_, nullptr)),
+        size_(std::exchange(other.size_, 0))
+#ifdef _WIN32
+        , file_(std::exchange(other.file_, nullptr)),
+        mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+    {
+    }
+
+    auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile&
+    {
+        if (this != &other)
+        {
+            Release();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+            file_ = std::exchange(other.file_, nullptr);
+            mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    auto MappedFile::Release() noexcept -> void
+    {
+#ifdef _WIN32
+        if (data_ != nullptr) { UnmapViewOfFile(data_); }
+        if (mapping_ != nullptr) { CloseHandle(mapping_); }
+        if (file_ != nullptr) { CloseHandle(file_); }
+        file_ = nullptr;
+        mapping_ = nullptr;
+#else
+        if (data_ != nullptr) { ::munmap(const_cast<void*>(data_), size_); }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    auto MappedFile::Open(std::string const& path) -> std::expected<MappedFile, ReplayError>
+    {
+        MappedFile mf{};
+#ifdef _WIN32
+        HANDLE const file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) { return std::unexpected(ReplayError{0, "cannot open " + path}); }
+        mf.file_ = file;
+
+        LARGE_INTEGER sz{};
+        if (!GetFileSizeEx(file, &sz)) { return std::unexpected(ReplayError{0, "cannot stat " + path}); }
+        mf.size_ = static_cast<std::size_t>(sz.QuadPart);
+        if (mf.size_ == 0) { return mf; }
+
+        mf.mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mf.mapping_ == nullptr) { return std::unexpected(ReplayError{0, "cannot map " + path}); }
+        mf.data_ = MapViewOfFile(mf.mapping_, FILE_MAP_READ, 0, 0, 0);
+        if (mf.data_ == nullptr) { return std::unexpected(ReplayError{0, "cannot map " + path}); }
+#else
+        int const fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) { return std::unexpected(ReplayError{0, "cannot open " + path}); }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            return std::unexpected(ReplayError{0, "cannot stat " + path});
+        }
+        if (st.st_size == 0)
+        {
+            ::close(fd);
+            return mf;
+        }
+
+        void* const p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping keeps its own reference
+        if (p == MAP_FAILED) { return std::unexpected(ReplayError{0, "cannot map " + path}); }
+        mf.data_ = p;
+        mf.size_ = static_cast<std::size_t>(st.st_size);
+#endif
+        return mf;
+    }
+
+    // ---------------- Reader ----------------
+
+    auto ReplayReader::Open(std::string const& path) -> std::expected<ReplayReader, ReplayError>
+    {
+        auto mf = MappedFile::Open(path);
+        if (!mf.has_value()) { return std::unexpected(std::move(mf.error())); }
+        return ReplayReader(std::move(*mf));
+    }
+
+    auto ReplayReader::NextGame() -> std::expected<std::optional<ReplayGame>, ReplayError>
+    {
+        std::span<std::uint8_t const> const bytes = file_.Bytes();
+        Cursor c(bytes, pos_);
+        if (c.AtEnd()) { return std::optional<ReplayGame>{}; }
+
+        ReplayGame game{};
+
+        // Header
+        std::array<std::uint8_t, 4> magic{};
+        if (!c.Bytes(magic.data(), magic.size()) || magic != Magic) { return Fail(c, "bad magic"); }
+
+        std::uint8_t version{}, rules{}, n_players{}, deal{}, flags{};
+        if (!c.U8(version) || !c.U8(rules) || !c.U8(n_players) || !c.U8(deal) || !c.U8(flags))
+        {
+            return Fail(c, "truncated header");
+        }
+        if (version != ReplayVersion) { return Fail(c, "unsupported version"); }
+
+        std::uint64_t seed{}, timeout_ms{};
+        if (!c.Varint(seed) || !c.Varint(timeout_ms)) { return Fail(c, "truncated header"); }
+
+        game.header.rules = static_cast<ReplayRules>(rules);
+        game.header.config.n_players = n_players;
+        game.header.config.deal_up_to = deal;
+        game.header.config.deck36 = (flags & 0x1u) != 0;
+        game.header.config.counter_rng = (flags & 0x2u) != 0;
+        game.header.config.seed = seed;
+        game.header.config.turn_timeout = std::chrono::milliseconds(timeout_ms);
+        game.header.players.resize(n_players);
+        for (ReplayPlayerKind& k : game.header.players)
+        {
+            std::uint8_t v{};
+            if (!c.U8(v)) { return Fail(c, "truncated header"); }
+            k = static_cast<ReplayPlayerKind>(v);
+        }
+
+        // Records until the end tag (or a clean cut at end of file for crashed writers)
+        while (true)
+        {
+            std::uint8_t tag{};
+            if (!c.U8(tag)) { break; }
+
+            if (tag == ReplayEndTag)
+            {
+                std::uint8_t loser{};
+                std::uint64_t count{};
+                if (!c.U8(loser) || !c.Varint(count)) { return Fail(c, "truncated end record"); }
+                if (count != game.records.size()) { return Fail(c, "record count mismatch"); }
+                if (loser == ReplayAborted) { break; }
+                if (loser != ReplayNoSeat) { game.loser = loser; }
+                game.complete = true;
+                break;
+            }
+
+            ReplayRecord r{};
+            r.kind = static_cast<std::uint8_t>(tag & 0x7u);
+            r.outcome = static_cast<MoveOutcome>((tag >> 3) & 0x3u);
+            r.actor = static_cast<PlyrIdxT>(tag >> 5);
+            if (r.kind >= std::variant_size_v<PlayerAction>) { return Fail(c, "bad action kind"); }
+
+            std::size_t n_bytes = 0;
+            switch (r.kind)
+            {
+            case 0: // Attack
+            case 1: // Defend
+                if (!c.U8(r.count) || r.count > constants::MaxTableSlots) { return Fail(c, "bad card count"); }
+                n_bytes = (r.kind == 0) ? r.count : 2u * r.count;
+                break;
+            case 2: // Transfer
+                r.count = 1;
+                n_bytes = 1;
+                break;
+            default:
+                break;
+            }
+            if (!c.Bytes(r.cards.data(), n_bytes)) { return Fail(c, "truncated record"); }
+
+            game.records.push_back(r);
+        }
+
+        pos_ = c.Pos();
+        return std::optional<ReplayGame>{std::move(game)};
+    }
+}
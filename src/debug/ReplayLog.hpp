@@ -0,0 +1,177 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_REPLAYLOG_HPP
+#define IDIOTGAME_REPLAYLOG_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "../core/Actions.hpp"
+#include "../core/Game.hpp"
+#include "../core/Types.hpp"
+
+/*
+ * Binary replay format (append-only; a file holds any number of games back to back)
+ *
+ * Game header:
+ *   "DRKR"         magic
+ *   u8             format version
+ *   u8             rules id (ReplayRules)
+ *   u8             n_players
+ *   u8             deal_up_to
+ *   u8             flags (bit0 = deck36, bit1 = counter_rng)
+ *   varint         seed
+ *   varint         turn_timeout (ms)
+ *   u8[n_players]  player kinds (ReplayPlayerKind)
+ *
+ * Action record (one per Step):
+ *   u8 tag = kind (3 bits, PlayerAction index) | outcome << 3 (2 bits) | actor << 5 (3 bits)
+ *   Attack:   u8 count, count * u8 card uid
+ *   Defend:   u8 count, count * (u8 attack uid, u8 defend uid)
+ *   Transfer: u8 card uid
+ *   Pass/Take: nothing
+ *
+ * End record:
+ *   u8 0xFF, u8 loser seat (0xFF = draw, 0xFE = aborted), varint record count
+ *
+ * The deck is rebuilt from the seed, so a typical game costs a few hundred bytes.
+ */
+namespace durak::core::debug
+{
+    enum class ReplayRules : std::uint8_t
+    {
+        Classic = 0
+    };
+
+    enum class ReplayPlayerKind : std::uint8_t
+    {
+        Unknown = 0,
+        Random,
+        Remote
+    };
+
+    inline constexpr std::uint8_t ReplayVersion = 1;
+    inline constexpr std::uint8_t ReplayEndTag = 0xFF;
+    inline constexpr std::uint8_t ReplayNoCard = 0xFF;
+    inline constexpr std::uint8_t ReplayNoSeat = 0xFF;
+    inline constexpr std::uint8_t ReplayAborted = 0xFE;
+
+    struct ReplayHeader
+    {
+        Config config{};
+        ReplayRules rules{ReplayRules::Classic};
+        std::vector<ReplayPlayerKind> players{};
+    };
+
+    // Decoded action. Cards are uids (util::CardToUID); defend pairs are interleaved attack/defend.
+    struct ReplayRecord
+    {
+        PlyrIdxT actor{0};
+        std::uint8_t kind{0}; // PlayerAction::index()
+        MoveOutcome outcome{MoveOutcome::Invalid};
+        std::uint8_t count{0};
+        std::array<std::uint8_t, 2 * constants::MaxTableSlots> cards{};
+    };
+
+    struct ReplayGame
+    {
+        ReplayHeader header{};
+        std::vector<ReplayRecord> records{};
+        std::optional<PlyrIdxT> loser{};
+        bool complete{false}; // false when the game was aborted or the file was cut short
+    };
+
+    struct ReplayError
+    {
+        std::size_t offset{0};
+        std::string message{};
+    };
+
+    class ReplayWriter
+    {
+    public:
+        explicit ReplayWriter(std::string const& path);
+        ~ReplayWriter();
+
+        ReplayWriter(ReplayWriter const&) = delete;
+        auto operator=(ReplayWriter const&) -> ReplayWriter& = delete;
+
+        auto Begin(Config const& cfg, ReplayRules rules, std::span<ReplayPlayerKind const> players) -> void;
+
+        // Record the action the game resolved in its last Step().
+        auto Record(GameImpl const& game, MoveOutcome outcome) -> void;
+        auto Record(PlyrIdxT actor, PlayerAction const& action, MoveOutcome outcome) -> void;
+
+        // Writes the end record; loser is whichever seat still holds cards.
+        auto End(GameImpl const& game) -> void;
+        auto End(std::optional<PlyrIdxT> loser) -> void;
+
+        // Closes an unfinished game so the next appended game still parses (also done on destruction).
+        auto Abort() -> void;
+
+        // Push buffered bytes to the file (a partial game is still readable).
+        auto Flush() -> void;
+
+    private:
+        std::ofstream out_;
+        std::vector<std::uint8_t> buf_;
+        std::uint64_t records_{0};
+        bool open_{false};
+    };
+
+    // Read-only memory mapping of a whole file.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile const&) = delete;
+        auto operator=(MappedFile const&) -> MappedFile& = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+        static auto Open(std::string const& path) -> std::expected<MappedFile, ReplayError>;
+
+        auto Bytes() const noexcept -> std::span<std::uint8_t const>
+        {
+            return {static_cast<std::uint8_t const*>(data_), size_};
+        }
+
+    private:
+        auto Release() noexcept -> void;
+
+        void const* data_{nullptr};
+        std::size_t size_{0};
+#ifdef _WIN32
+        void* file_{nullptr};
+        void* mapping_{nullptr};
+#endif
+    };
+
+    class ReplayReader
+    {
+    public:
+        static auto Open(std::string const& path) -> std::expected<ReplayReader, ReplayError>;
+
+        // Parses the next game; empty optional at end of file.
+        auto NextGame() -> std::expected<std::optional<ReplayGame>, ReplayError>;
+
+    private:
+        explicit ReplayReader(MappedFile file) : file_(std::move(file)) {}
+
+        MappedFile file_;
+        std::size_t pos_{0};
+    };
+}
+
+#endif //IDIOTGAME_REPLAYLOG_HPP
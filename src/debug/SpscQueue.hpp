@@ -0,0 +1,76 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_SPSCQUEUE_HPP
+#define IDIOTGAME_SPSCQUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace durak::core::debug
+{
+    // Bounded single-producer/single-consumer ring of trivially copyable records.
+    // Head and tail live on separate cache lines; indices grow monotonically and wrap via the mask.
+    template <typename T, std::size_t Capacity>
+    class SpscQueue
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "SpscQueue holds POD records only");
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        // Producer side. Returns false when full.
+        auto TryPush(T const& v) noexcept -> bool
+        {
+            std::size_t const tail = tail_.load(std::memory_order_relaxed);
+            if (tail - head_cache_ == Capacity)
+            {
+                head_cache_ = head_.load(std::memory_order_acquire);
+                if (tail - head_cache_ == Capacity) { return false; }
+            }
+            slots_[tail & Mask] = v;
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side. Copies up to out.size() records, returns how many.
+        template <std::size_t N>
+        auto PopBatch(std::array<T, N>& out) noexcept -> std::size_t
+        {
+            std::size_t const head = head_.load(std::memory_order_relaxed);
+            std::size_t const avail = tail_.load(std::memory_order_acquire) - head;
+            std::size_t const n = avail < N ? avail : N;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                out[i] = slots_[(head + i) & Mask];
+            }
+            head_.store(head + n, std::memory_order_release);
+            return n;
+        }
+
+        // Consumer side: block until the producer publishes past 'seen_tail'.
+        auto WaitForData(std::size_t const seen_tail) const noexcept -> void
+        {
+            tail_.wait(seen_tail, std::memory_order_acquire);
+        }
+
+        auto Tail() const noexcept -> std::size_t { return tail_.load(std::memory_order_acquire); }
+
+        // Producer side: wake a consumer parked in WaitForData().
+        auto Notify() noexcept -> void { tail_.notify_one(); }
+
+    private:
+        static constexpr std::size_t Mask = Capacity - 1;
+        static constexpr std::size_t Line = 64;
+
+        alignas(Line) std::atomic<std::size_t> head_{0};
+        alignas(Line) std::atomic<std::size_t> tail_{0};
+        alignas(Line) std::size_t head_cache_{0}; // producer-local view of head_
+        alignas(Line) std::array<T, Capacity> slots_{};
+    };
+}
+
+#endif //IDIOTGAME_SPSCQUEUE_HPP
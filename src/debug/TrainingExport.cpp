@@ -0,0 +1,342 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "TrainingExport.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "../core/CardMasks.hpp"
+#include "../core/Exception.hpp"
+#include "../core/Util.hpp"
+
+namespace durak::core::debug
+{
+    namespace
+    {
+        constexpr std::array<std::uint8_t, 4> FileMagic{'D', 'R', 'K', 'T'};
+        constexpr std::array<std::uint8_t, 4> GroupMagic{'D', 'R', 'K', 'G'};
+        constexpr std::array<std::uint8_t, 8> IndexMagic{'D', 'R', 'K', 'T', 'I', 'D', 'X', '\0'};
+        constexpr std::size_t FileHeaderBytes = 64;
+        constexpr std::size_t GroupHeaderBytes = 16;
+        constexpr std::size_t FooterBytes = 24;
+
+        auto Align8(std::uint64_t const n) -> std::uint64_t { return (n + 7) & ~std::uint64_t{7}; }
+
+        auto Bit(CardWP const& w) -> std::uint64_t
+        {
+            CardSP const sp = w.lock();
+            return sp ? std::uint64_t{1} << util::CardToUID(*sp) : 0;
+        }
+
+        auto UidOf(CardWP const& w) -> std::uint8_t
+        {
+            CardSP const sp = w.lock();
+            return sp ? static_cast<std::uint8_t>(util::CardToUID(*sp)) : ReplayNoCard;
+        }
+
+        auto Put(std::vector<std::uint8_t>& out, void const* p, std::size_t const n) -> void
+        {
+            auto const* b = static_cast<std::uint8_t const*>(p);
+            out.insert(out.end(), b, b + n);
+        }
+
+        auto PutU32(std::vector<std::uint8_t>& out, std::uint32_t const v) -> void { Put(out, &v, sizeof v); }
+        auto PutU64(std::vector<std::uint8_t>& out, std::uint64_t const v) -> void { Put(out, &v, sizeof v); }
+
+        template <class T>
+        auto Load(std::span<std::uint8_t const> const bytes, std::size_t const pos) -> T
+        {
+            T v{};
+            std::memcpy(&v, bytes.data() + pos, sizeof v);
+            return v;
+        }
+
+        // Column offsets of a group starting at 'base' (same walk the writer does).
+        auto ColumnOffsets(std::uint64_t const base, std::uint32_t const rows)
+            -> std::pair<std::array<std::uint64_t, TrainingColumnCount>, std::uint64_t>
+        {
+            std::array<std::uint64_t, TrainingColumnCount> cols{};
+            std::uint64_t off = base + GroupHeaderBytes;
+            std::size_t i = 0;
+            ForEachTrainingColumn([&](auto m)
+            {
+                using T = std::remove_cvref_t<decltype(std::declval<TrainingRow const&>().*m)>;
+                cols[i++] = off;
+                off += Align8(std::uint64_t{rows} * sizeof(T));
+            });
+            return {cols, off - base};
+        }
+    }
+
+    auto MakeTrainingRow(GameSnapshot const& s, PlyrIdxT const seat, PlayerAction const& chosen) -> TrainingRow
+    {
+        TrainingRow r{};
+        r.seat = seat;
+        r.n_players = s.n_players;
+        r.trump = std::to_underlying(s.trump);
+        r.phase = std::to_underlying(s.phase);
+        r.attacker = s.attacker_idx;
+        r.defender = s.defender_idx;
+        r.deck_count = s.deck_count;
+        r.bout_cap = s.bout_cap;
+        r.attacks_used = s.attacks_used;
+        for (std::size_t i = 0; i < s.other_counts.size() && i < r.counts.size(); ++i)
+        {
+            r.counts[i] = s.other_counts[i];
+        }
+        for (CardWP const& w : s.my_hand) { r.hand |= Bit(w); }
+        r.counts[seat] = static_cast<std::uint8_t>(std::popcount(r.hand));
+        r.unseen = s.unseen_mask;
+
+        std::uint64_t uncovered{0};
+        std::uint64_t cover_any{0};
+        for (TableSlotView const& ts : s.table)
+        {
+            std::uint64_t const a = Bit(ts.attack);
+            std::uint64_t const d = Bit(ts.defend);
+            r.table_atk |= a;
+            r.table_def |= d;
+            if (a != 0 && d == 0)
+            {
+                uncovered |= a;
+                cover_any |= masks::Beaters(static_cast<std::uint8_t>(std::countr_zero(a)), s.trump);
+            }
+        }
+
+        // Legal sets, as ClassicRules validates them
+        if (s.phase == Phase::Attacking && seat == s.attacker_idx)
+        {
+            std::size_t const def_cards = s.defender_idx < s.other_counts.size() ? s.other_counts[s.defender_idx] : 0;
+            std::size_t const cap = s.attacks_used == 0 ? std::min(constants::MaxTableSlots, def_cards) : s.bout_cap;
+            if (s.attacks_used < cap)
+            {
+                std::uint64_t const same_rank = masks::CardsOfRanks(masks::RanksOf(r.table_atk | r.table_def));
+                r.legal_attack = s.attacks_used == 0 ? r.hand : r.hand & same_rank;
+            }
+            if (s.attacks_used != 0 && uncovered == 0) { r.legal_flags |= TrainingPassLegal; }
+        }
+        else if (s.phase == Phase::Defending && seat == s.defender_idx)
+        {
+            r.legal_cover = r.hand & cover_any;
+            r.legal_flags |= TrainingTakeLegal;
+        }
+
+        r.kind = static_cast<std::uint8_t>(chosen.index());
+        r.cards.fill(ReplayNoCard);
+        std::visit([&](auto const& a)
+        {
+            using T = std::decay_t<decltype(a)>;
+            if constexpr (std::is_same_v<T, AttackAction>)
+            {
+                for (std::size_t i = 0; i < a.cards.size() && i < constants::MaxTableSlots; ++i)
+                {
+                    r.cards[i] = UidOf(a.cards[i]);
+                }
+            }
+            else if constexpr (std::is_same_v<T, DefendAction>)
+            {
+                for (std::size_t i = 0; i < a.pairs.size() && i < constants::MaxTableSlots; ++i)
+                {
+                    r.cards[2 * i] = UidOf(a.pairs[i].attack);
+                    r.cards[2 * i + 1] = UidOf(a.pairs[i].defend);
+                }
+            }
+            else if constexpr (std::is_same_v<T, TransferAction>)
+            {
+                r.cards[0] = UidOf(a.card);
+            }
+        }, chosen);
+        return r;
+    }
+
+    // ---------------- Writer ----------------
+
+    TrainingWriter::TrainingWriter(std::string const& path) :
+        out_(path, std::ios::binary | std::ios::trunc)
+    {
+        DRK_ASSERT(out_.is_open(), "TrainingWriter: failed to open file");
+        std::vector<std::uint8_t> header;
+        header.reserve(FileHeaderBytes);
+        Put(header, FileMagic.data(), FileMagic.size());
+        PutU32(header, TrainingVersion);
+        PutU32(header, static_cast<std::uint32_t>(TrainingColumnCount));
+        header.resize(FileHeaderBytes, 0);
+        out_.write(reinterpret_cast<char const*>(header.data()), static_cast<std::streamsize>(header.size()));
+        pos_ = header.size();
+    }
+
+    TrainingWriter::~TrainingWriter()
+    {
+        Close();
+    }
+
+    auto TrainingWriter::Append(std::span<std::uint8_t const> const group, std::uint32_t const rows) -> void
+    {
+        std::lock_guard lock(mtx_);
+        DRK_ASSERT(!closed_, "TrainingWriter: append after close");
+        out_.write(reinterpret_cast<char const*>(group.data()), static_cast<std::streamsize>(group.size()));
+        index_.push_back(pos_);
+        index_.push_back(rows);
+        pos_ += group.size();
+    }
+
+    auto TrainingWriter::Close() -> void
+    {
+        std::lock_guard lock(mtx_);
+        if (closed_) { return; }
+        closed_ = true;
+
+        std::vector<std::uint8_t> tail;
+        for (std::uint64_t const v : index_) { PutU64(tail, v); }
+        PutU64(tail, pos_);
+        PutU64(tail, index_.size() / 2);
+        Put(tail, IndexMagic.data(), IndexMagic.size());
+        out_.write(reinterpret_cast<char const*>(tail.data()), static_cast<std::streamsize>(tail.size()));
+        out_.flush();
+    }
+
+    // ---------------- Sink ----------------
+
+    TrainingSink::TrainingSink(TrainingWriter& writer, std::uint32_t const group_rows) :
+        writer_(&writer),
+        group_rows_(std::max<std::uint32_t>(group_rows, 1))
+    {
+        group_.reserve(group_rows_);
+    }
+
+    TrainingSink::~TrainingSink()
+    {
+        EndGame(std::nullopt); // a game still open is kept, scored as abandoned
+        Flush();
+    }
+
+    auto TrainingSink::Decision(GameSnapshot const& s, PlyrIdxT const seat, PlayerAction const& chosen) -> void
+    {
+        TrainingRow& r = game_.emplace_back(MakeTrainingRow(s, seat, chosen));
+        r.ply = static_cast<std::uint16_t>(game_.size() - 1);
+    }
+
+    auto TrainingSink::EndGame(std::optional<PlyrIdxT> const loser) -> void
+    {
+        if (game_.empty()) { return; }
+        std::uint64_t const id = writer_->NextGameId();
+        for (TrainingRow& r : game_)
+        {
+            r.game = id;
+            r.result = !loser ? std::int8_t{0} : (r.seat == *loser ? std::int8_t{-1} : std::int8_t{1});
+            group_.push_back(r);
+            if (group_.size() == group_rows_) { Flush(); }
+        }
+        game_.clear();
+    }
+
+    auto TrainingSink::Flush() -> void
+    {
+        if (group_.empty()) { return; }
+        auto const rows = static_cast<std::uint32_t>(group_.size());
+        auto const [cols, size] = ColumnOffsets(0, rows);
+
+        bytes_.assign(size, 0);
+        std::memcpy(bytes_.data(), GroupMagic.data(), GroupMagic.size());
+        std::memcpy(bytes_.data() + 4, &rows, sizeof rows);
+        std::memcpy(bytes_.data() + 8, &size, sizeof size);
+
+        std::size_t i = 0;
+        ForEachTrainingColumn([&](auto m)
+        {
+            using T = std::remove_cvref_t<decltype(std::declval<TrainingRow const&>().*m)>;
+            std::uint8_t* dst = bytes_.data() + cols[i++];
+            for (TrainingRow const& r : group_)
+            {
+                std::memcpy(dst, &(r.*m), sizeof(T));
+                dst += sizeof(T);
+            }
+        });
+
+        writer_->Append(bytes_, rows);
+        group_.clear();
+    }
+
+    // ---------------- Reader ----------------
+
+    auto TrainingReader::Open(std::string const& path) -> std::expected<TrainingReader, ReplayError>
+    {
+        auto mf = MappedFile::Open(path);
+        if (!mf.has_value()) { return std::unexpected(std::move(mf.error())); }
+        TrainingReader rd(std::move(*mf));
+        std::span<std::uint8_t const> const bytes = rd.file_.Bytes();
+
+        if (bytes.size() < FileHeaderBytes || !std::equal(FileMagic.begin(), FileMagic.end(), bytes.begin()))
+        {
+            return std::unexpected(ReplayError{0, "not a training file"});
+        }
+        if (Load<std::uint32_t>(bytes, 4) != TrainingVersion ||
+            Load<std::uint32_t>(bytes, 8) != TrainingColumnCount)
+        {
+            return std::unexpected(ReplayError{4, "unsupported training format version"});
+        }
+
+        auto add_group = [&](std::uint64_t const off, std::uint32_t const rows)
+        {
+            rd.groups_.push_back(Group{rows, ColumnOffsets(off, rows).first});
+            rd.total_rows_ += rows;
+        };
+
+        // Fast path: the index at the end
+        if (bytes.size() >= FileHeaderBytes + FooterBytes &&
+            std::equal(IndexMagic.begin(), IndexMagic.end(), bytes.end() - IndexMagic.size()))
+        {
+            std::size_t const tail = bytes.size() - FooterBytes;
+            auto const index_off = Load<std::uint64_t>(bytes, tail);
+            auto const groups = Load<std::uint64_t>(bytes, tail + 8);
+            if (index_off + groups * 16 == tail)
+            {
+                for (std::uint64_t g = 0; g < groups; ++g)
+                {
+                    auto const off = Load<std::uint64_t>(bytes, index_off + g * 16);
+                    auto const rows = Load<std::uint64_t>(bytes, index_off + g * 16 + 8);
+                    if (off + ColumnOffsets(off, static_cast<std::uint32_t>(rows)).second > index_off)
+                    {
+                        return std::unexpected(ReplayError{index_off + g * 16, "index entry out of range"});
+                    }
+                    add_group(off, static_cast<std::uint32_t>(rows));
+                }
+                rd.indexed_ = true;
+                return rd;
+            }
+        }
+
+        // No index (writer never closed): walk whole groups
+        std::size_t pos = FileHeaderBytes;
+        while (pos + GroupHeaderBytes <= bytes.size() &&
+               std::equal(GroupMagic.begin(), GroupMagic.end(), bytes.begin() + static_cast<std::ptrdiff_t>(pos)))
+        {
+            auto const rows = Load<std::uint32_t>(bytes, pos + 4);
+            auto const size = Load<std::uint64_t>(bytes, pos + 8);
+            if (size != ColumnOffsets(pos, rows).second || pos + size > bytes.size()) { break; }
+            add_group(pos, rows);
+            pos += size;
+        }
+        return rd;
+    }
+
+    auto TrainingReader::Row(std::size_t const g, std::size_t const i) const -> TrainingRow
+    {
+        TrainingRow r{};
+        Group const& grp = groups_[g];
+        std::span<std::uint8_t const> const bytes = file_.Bytes();
+        std::size_t c = 0;
+        ForEachTrainingColumn([&](auto m)
+        {
+            using T = std::remove_cvref_t<decltype(std::declval<TrainingRow const&>().*m)>;
+            std::memcpy(&(r.*m), bytes.data() + grp.columns[c++] + i * sizeof(T), sizeof(T));
+        });
+        return r;
+    }
+}
@@ -0,0 +1,228 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_TRAININGEXPORT_HPP
+#define IDIOTGAME_TRAININGEXPORT_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../core/Actions.hpp"
+#include "../core/State.hpp"
+#include "../core/Tournament.hpp"
+#include "../core/Types.hpp"
+#include "ReplayLog.hpp"
+
+/*
+ * Columnar training-data format (little-endian, every column 8-byte aligned in the file)
+ *
+ * File header (64 bytes):
+ *   "DRKT"  magic
+ *   u32     format version
+ *   u32     column count
+ *   u32     reserved, then zero padding
+ *
+ * Row group (any number, back to back):
+ *   "DRKG"  magic
+ *   u32     rows
+ *   u64     group size in bytes, header included
+ *   columns in ForEachTrainingColumn order: rows * sizeof(field) bytes each, zero padded to 8
+ *
+ * Index (written on close):
+ *   { u64 group offset, u64 rows } per group
+ *   u64 index offset, u64 group count, "DRKTIDX\0"
+ *
+ * A file cut short (no index) still reads: groups are walked from their headers up to the last whole one.
+ */
+namespace durak::core::debug
+{
+    inline constexpr std::uint32_t TrainingVersion = 1;
+    inline constexpr std::uint32_t TrainingGroupRows = 16384;
+    inline constexpr std::uint8_t TrainingPassLegal = 0x1;
+    inline constexpr std::uint8_t TrainingTakeLegal = 0x2;
+
+    // One decision seen from the acting seat. Card sets are util::CardToUID bitmasks.
+    struct TrainingRow
+    {
+        std::uint64_t game{0}; // writer-wide game id
+        std::uint16_t ply{0}; // decision index within the game
+        std::uint8_t seat{0};
+        std::uint8_t n_players{0};
+        std::uint8_t trump{0};
+        std::uint8_t phase{0};
+        std::uint8_t attacker{0};
+        std::uint8_t defender{0};
+        std::uint8_t deck_count{0};
+        std::uint8_t bout_cap{0};
+        std::uint8_t attacks_used{0};
+        std::array<std::uint8_t, constants::MaxPlayers> counts{}; // hand sizes, own seat included
+        std::uint64_t hand{0};
+        std::uint64_t table_atk{0};
+        std::uint64_t table_def{0};
+        std::uint64_t unseen{0}; // opponent hands + deck
+        std::uint64_t legal_attack{0}; // cards playable as an attack now
+        std::uint64_t legal_cover{0}; // cards that beat at least one uncovered attack
+        std::uint8_t legal_flags{0}; // TrainingPassLegal | TrainingTakeLegal
+        std::uint8_t kind{0}; // chosen PlayerAction::index()
+        std::array<std::uint8_t, 2 * constants::MaxTableSlots> cards{}; // as ReplayRecord::cards, ReplayNoCard padded
+        std::int8_t result{0}; // +1 got out, -1 lost, 0 draw or aborted
+    };
+
+    template <class F>
+    constexpr auto ForEachTrainingColumn(F&& f) -> void
+    {
+        f(&TrainingRow::game);
+        f(&TrainingRow::ply);
+        f(&TrainingRow::seat);
+        f(&TrainingRow::n_players);
+        f(&TrainingRow::trump);
+        f(&TrainingRow::phase);
+        f(&TrainingRow::attacker);
+        f(&TrainingRow::defender);
+        f(&TrainingRow::deck_count);
+        f(&TrainingRow::bout_cap);
+        f(&TrainingRow::attacks_used);
+        f(&TrainingRow::counts);
+        f(&TrainingRow::hand);
+        f(&TrainingRow::table_atk);
+        f(&TrainingRow::table_def);
+        f(&TrainingRow::unseen);
+        f(&TrainingRow::legal_attack);
+        f(&TrainingRow::legal_cover);
+        f(&TrainingRow::legal_flags);
+        f(&TrainingRow::kind);
+        f(&TrainingRow::cards);
+        f(&TrainingRow::result);
+    }
+
+    inline constexpr std::size_t TrainingColumnCount = []
+    {
+        std::size_t n = 0;
+        ForEachTrainingColumn([&](auto) { ++n; });
+        return n;
+    }();
+
+    template <auto Member>
+    consteval auto TrainingColumnIndex() -> std::size_t
+    {
+        std::size_t i = 0;
+        std::size_t found = TrainingColumnCount;
+        ForEachTrainingColumn([&](auto m)
+        {
+            if constexpr (std::is_same_v<decltype(m), decltype(Member)>)
+            {
+                if (m == Member) { found = i; }
+            }
+            ++i;
+        });
+        return found;
+    }
+
+    template <auto Member>
+    using TrainingColumnT = std::remove_cvref_t<decltype(std::declval<TrainingRow const&>().*Member)>;
+
+    // Features and legal-move masks for the seat a snapshot was taken for (the current actor).
+    auto MakeTrainingRow(GameSnapshot const& s, PlyrIdxT seat, PlayerAction const& chosen) -> TrainingRow;
+
+    // Thread-safe sink for finished row groups; writes the index on Close().
+    class TrainingWriter
+    {
+    public:
+        explicit TrainingWriter(std::string const& path);
+        ~TrainingWriter();
+
+        TrainingWriter(TrainingWriter const&) = delete;
+        auto operator=(TrainingWriter const&) -> TrainingWriter& = delete;
+
+        // One serialized group (header included), as built by TrainingSink.
+        auto Append(std::span<std::uint8_t const> group, std::uint32_t rows) -> void;
+        auto NextGameId() noexcept -> std::uint64_t { return games_.fetch_add(1, std::memory_order_relaxed); }
+        auto Close() -> void;
+
+    private:
+        std::mutex mtx_;
+        std::ofstream out_;
+        std::uint64_t pos_{0};
+        std::vector<std::uint64_t> index_; // offset, rows pairs
+        std::atomic<std::uint64_t> games_{0};
+        bool closed_{false};
+    };
+
+    // Per-thread row collector. Buffers one game until its result is known, and encodes full groups
+    // without holding the writer's lock. Plugs into RunTournament as a DuelObserver.
+    class TrainingSink final : public DuelObserver
+    {
+    public:
+        explicit TrainingSink(TrainingWriter& writer, std::uint32_t group_rows = TrainingGroupRows);
+        ~TrainingSink() override;
+
+        TrainingSink(TrainingSink const&) = delete;
+        auto operator=(TrainingSink const&) -> TrainingSink& = delete;
+
+        auto Decision(GameSnapshot const& s, PlyrIdxT seat, PlayerAction const& chosen) -> void override;
+        auto EndGame(std::optional<PlyrIdxT> loser) -> void override;
+        auto Flush() -> void;
+
+    private:
+        TrainingWriter* writer_;
+        std::uint32_t group_rows_;
+        std::vector<TrainingRow> game_;
+        std::vector<TrainingRow> group_;
+        std::vector<std::uint8_t> bytes_;
+    };
+
+    // Zero-copy reader over a mapped file: columns come back as spans into the mapping.
+    class TrainingReader
+    {
+    public:
+        static auto Open(std::string const& path) -> std::expected<TrainingReader, ReplayError>;
+
+        auto Groups() const noexcept -> std::size_t { return groups_.size(); }
+        auto Rows(std::size_t const g) const noexcept -> std::uint32_t { return groups_[g].rows; }
+        auto TotalRows() const noexcept -> std::uint64_t { return total_rows_; }
+        auto Indexed() const noexcept -> bool { return indexed_; } // false = recovered from a cut file
+
+        template <auto Member>
+        auto Column(std::size_t const g) const -> std::span<TrainingColumnT<Member> const>
+        {
+            constexpr std::size_t col = TrainingColumnIndex<Member>();
+            static_assert(col < TrainingColumnCount, "not a training column");
+            Group const& grp = groups_[g];
+            auto const* p = file_.Bytes().data() + grp.columns[col];
+            return {reinterpret_cast<TrainingColumnT<Member> const*>(p), grp.rows};
+        }
+
+        // Gathers one row from every column (for inspection; scans should use Column()).
+        auto Row(std::size_t g, std::size_t i) const -> TrainingRow;
+
+    private:
+        struct Group
+        {
+            std::uint32_t rows{0};
+            std::array<std::uint64_t, TrainingColumnCount> columns{}; // absolute offsets
+        };
+
+        explicit TrainingReader(MappedFile file) : file_(std::move(file)) {}
+
+        MappedFile file_;
+        std::vector<Group> groups_;
+        std::uint64_t total_rows_{0};
+        bool indexed_{false};
+    };
+
+    static_assert(std::endian::native == std::endian::little, "training files are little-endian");
+}
+
+#endif //IDIOTGAME_TRAININGEXPORT_HPP
@@ -451,7 +451,10 @@ struct SeatView FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_OTHER_COUNTS = 22,
     VT_BOUT_CAP = 24,
     VT_ATTACKS_USED = 26,
-    VT_DEFENDER_TOOK = 28
+    VT_DEFENDER_TOOK = 28,
+    VT_DECK_COUNT = 30,
+    VT_DEAL_UP_TO = 32,
+    VT_UNSEEN_MASK = 34
   };
   uint16_t schema_version() const {
     return GetField<uint16_t>(VT_SCHEMA_VERSION, 0);
@@ -492,6 +495,15 @@ struct SeatView FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   bool defender_took() const {
     return GetField<uint8_t>(VT_DEFENDER_TOOK, 0) != 0;
   }
+  uint8_t deck_count() const {
+    return GetField<uint8_t>(VT_DECK_COUNT, 0);
+  }
+  uint8_t deal_up_to() const {
+    return GetField<uint8_t>(VT_DEAL_UP_TO, 0);
+  }
+  uint64_t unseen_mask() const {
+    return GetField<uint64_t>(VT_UNSEEN_MASK, 0);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<uint16_t>(verifier, VT_SCHEMA_VERSION, 2) &&
@@ -512,6 +524,9 @@ struct SeatView FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyField<uint8_t>(verifier, VT_BOUT_CAP, 1) &&
            VerifyField<uint8_t>(verifier, VT_ATTACKS_USED, 1) &&
            VerifyField<uint8_t>(verifier, VT_DEFENDER_TOOK, 1) &&
+           VerifyField<uint8_t>(verifier, VT_DECK_COUNT, 1) &&
+           VerifyField<uint8_t>(verifier, VT_DEAL_UP_TO, 1) &&
+           VerifyField<uint64_t>(verifier, VT_UNSEEN_MASK, 8) &&
            verifier.EndTable();
   }
 };
@@ -559,6 +574,15 @@ struct SeatViewBuilder {
   void add_defender_took(bool defender_took) {
     fbb_.AddElement<uint8_t>(SeatView::VT_DEFENDER_TOOK, static_cast<uint8_t>(defender_took), 0);
   }
+  void add_deck_count(uint8_t deck_count) {
+    fbb_.AddElement<uint8_t>(SeatView::VT_DECK_COUNT, deck_count, 0);
+  }
+  void add_deal_up_to(uint8_t deal_up_to) {
+    fbb_.AddElement<uint8_t>(SeatView::VT_DEAL_UP_TO, deal_up_to, 0);
+  }
+  void add_unseen_mask(uint64_t unseen_mask) {
+    fbb_.AddElement<uint64_t>(SeatView::VT_UNSEEN_MASK, unseen_mask, 0);
+  }
   explicit SeatViewBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -584,12 +608,18 @@ inline ::flatbuffers::Offset<SeatView> CreateSeatView(
     ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> other_counts = 0,
     uint8_t bout_cap = 0,
     uint8_t attacks_used = 0,
-    bool defender_took = false) {
+    bool defender_took = false,
+    uint8_t deck_count = 0,
+    uint8_t deal_up_to = 0,
+    uint64_t unseen_mask = 0) {
   SeatViewBuilder builder_(_fbb);
+  builder_.add_unseen_mask(unseen_mask);
   builder_.add_other_counts(other_counts);
   builder_.add_my_hand(my_hand);
   builder_.add_table(table);
   builder_.add_schema_version(schema_version);
+  builder_.add_deal_up_to(deal_up_to);
+  builder_.add_deck_count(deck_count);
   builder_.add_defender_took(defender_took);
   builder_.add_attacks_used(attacks_used);
   builder_.add_bout_cap(bout_cap);
@@ -616,7 +646,10 @@ inline ::flatbuffers::Offset<SeatView> CreateSeatViewDirect(
     const std::vector<uint8_t> *other_counts = nullptr,
     uint8_t bout_cap = 0,
     uint8_t attacks_used = 0,
-    bool defender_took = false) {
+    bool defender_took = false,
+    uint8_t deck_count = 0,
+    uint8_t deal_up_to = 0,
+    uint64_t unseen_mask = 0) {
   auto table__ = table ? _fbb.CreateVector<::flatbuffers::Offset<durak::gen::net::TableSlot>>(*table) : 0;
   auto my_hand__ = my_hand ? _fbb.CreateVector<::flatbuffers::Offset<durak::gen::net::Card>>(*my_hand) : 0;
   auto other_counts__ = other_counts ? _fbb.CreateVector<uint8_t>(*other_counts) : 0;
@@ -634,7 +667,10 @@ inline ::flatbuffers::Offset<SeatView> CreateSeatViewDirect(
       other_counts__,
       bout_cap,
       attacks_used,
-      defender_took);
+      defender_took,
+      deck_count,
+      deal_up_to,
+      unseen_mask);
 }
 
 struct Action_Attack FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
@@ -13,8 +13,10 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <print>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <unordered_map>
 #include <vector>
@@ -27,6 +29,9 @@
 #include "core/RandomAi.hpp"
 #include "core/Judge.hpp"
 #include "core/Exception.hpp"
+#include "core/ViolationGate.hpp"
+#include "debug/Invariants.hpp"
+#include "debug/ReplayLog.hpp"
 #include "net/RemotePlayer.hpp"
 #include "net/codec.hpp"
 
@@ -43,6 +48,10 @@ namespace
         std::uint8_t deal_up_to{6};
         std::uint64_t seed{123456789ULL};
         std::chrono::milliseconds turn_timeout{std::chrono::seconds(15)};
+        std::string replay_path{}; // empty = no replay recording
+        std::uint32_t check_every{0}; // 0 = no invariant sampling
+        durak::core::StackCapture stack_capture{durak::core::StackCapture::Lazy};
+        std::uint8_t violation_retries{3}; // invalid actions per turn before the default is applied
     };
 
     auto ParseArgs(int argc, char** argv) -> ServerConfig
@@ -91,26 +100,55 @@ namespace
                 std::uint64_t v{};
                 if (next_uint(v)) { cfg.turn_timeout = std::chrono::milliseconds(v); }
             }
+            else if (arg == "--check-every")
+            {
+                std::uint64_t v{};
+                if (next_uint(v)) { cfg.check_every = static_cast<std::uint32_t>(v); }
+            }
+            else if (arg == "--stack")
+            {
+                if (i + 1 < argc)
+                {
+                    std::string const v = argv[++i];
+                    if (v == "off") { cfg.stack_capture = durak::core::StackCapture::Off; }
+                    else if (v == "lazy") { cfg.stack_capture = durak::core::StackCapture::Lazy; }
+                    else if (v == "full") { cfg.stack_capture = durak::core::StackCapture::Full; }
+                }
+            }
+            else if (arg == "--retries")
+            {
+                std::uint64_t v{};
+                if (next_uint(v)) { cfg.violation_retries = static_cast<std::uint8_t>(v); }
+            }
+            else if (arg == "--replay")
+            {
+                if (i + 1 < argc) { cfg.replay_path = argv[++i]; }
+            }
         }
         return cfg;
     }
 
+    void SendTo(std::vector<std::shared_ptr<durak::net::SeatChannel>> const& chans,
+                durak::core::PlyrIdxT seat,
+                flatbuffers::DetachedBuffer const& buf)
+    {
+        std::span<std::byte const> b{
+            reinterpret_cast<std::byte const*>(buf.data()), buf.size()
+        };
+
+        if (seat < chans.size() && chans[seat] && chans[seat]->connected)
+        {
+            chans[seat]->SendBinary(b);
+        }
+    }
+
     void BroadcastSnapshots(durak::core::GameImpl const& game,
                             std::vector<std::shared_ptr<durak::net::SeatChannel>> const& chans,
                             std::uint64_t msg_id)
     {
         for (durak::core::PlyrIdxT seat = 0; seat < chans.size(); ++seat)
         {
-            auto const buf = durak::core::net::BuildSnapshot(game, seat, msg_id);
-            std::span<uint8_t const> bytes{buf.data(), buf.size()};
-            std::span<std::byte const> b{
-                reinterpret_cast<std::byte const*>(bytes.data()), bytes.size()
-            };
-
-            if (chans[seat] && chans[seat]->connected)
-            {
-                chans[seat]->SendBinary(b);
-            }
+            SendTo(chans, seat, durak::core::net::BuildSnapshot(game, seat, msg_id));
         }
     }
 }
@@ -121,6 +159,7 @@ int main(int argc, char** argv)
     using namespace durak::core;
 
     ServerConfig const sc = ParseArgs(argc, argv);
+    SetStackCapture(sc.stack_capture);
 
     std::print("[idiotd] starting on port {} with {} player(s)\n",
                sc.port, sc.n_players);
@@ -231,13 +270,15 @@ int main(int argc, char** argv)
     cfg.seed = sc.seed;
     cfg.turn_timeout = sc.turn_timeout;
 
-    auto rules = std::make_unique<ClassicRules>();
+    auto rules = MakeClassicRules(cfg);
 
     // Build players up front. For connected seats we use RemotePlayer (late-bound).
     std::vector<std::unique_ptr<Player>> players;
     players.reserve(sc.n_players);
 
     std::vector<durak::net::RemotePlayer*> remote_ptrs; // to bind after GameImpl exists
+    std::vector<debug::ReplayPlayerKind> kinds;
+    kinds.reserve(sc.n_players);
 
     for (std::size_t i = 0; i < sc.n_players; ++i)
     {
@@ -246,10 +287,12 @@ int main(int argc, char** argv)
             auto rp = std::make_unique<durak::net::RemotePlayer>(static_cast<PlyrIdxT>(i), chans[i]);
             remote_ptrs.push_back(rp.get());
             players.emplace_back(std::move(rp));
+            kinds.push_back(debug::ReplayPlayerKind::Remote);
         }
         else
         {
-            players.emplace_back(std::make_unique<RandomAI>(sc.seed + static_cast<uint64_t>(i * 1337u)));
+            players.emplace_back(std::make_unique<RandomAI>(CounterRng::SeedFor(sc.seed, 0, i)));
+            kinds.push_back(debug::ReplayPlayerKind::Random);
         }
     }
 
@@ -261,6 +304,19 @@ int main(int argc, char** argv)
         rp->BindGame(game);
     }
 
+    std::unique_ptr<debug::ReplayWriter> replay;
+    if (!sc.replay_path.empty())
+    {
+        replay = std::make_unique<debug::ReplayWriter>(sc.replay_path);
+        replay->Begin(cfg, debug::ReplayRules::Classic, kinds);
+    }
+
+    std::optional<debug::InvariantSampler> sampler;
+    if (sc.check_every != 0) { sampler.emplace(sc.check_every); }
+
+    ViolationGate gate(sc.n_players, [](std::string_view const line) { std::print("{}\n", line); },
+                       sc.violation_retries);
+
     std::uint64_t msg_counter{1};
     BroadcastSnapshots(game, chans, msg_counter++);
 
@@ -269,11 +325,38 @@ int main(int argc, char** argv)
     while (outcome != MoveOutcome::GameEnded)
     {
         outcome = game.Step();
+        if (replay) { replay->Record(game, outcome); }
+
+        // Rejected action: only the offender hears about it, then retries on the next DecisionRequest
+        // (its view did not change, so no snapshot is resent).
+        if (outcome == MoveOutcome::Invalid && game.LastViolation())
+        {
+            PlyrIdxT const seat = game.LastActor();
+            SendTo(chans, seat, durak::core::net::BuildViolation(*game.LastViolation(), msg_counter++));
+            if (gate.OnViolation(seat, *game.LastViolation()) == ViolationGate::Verdict::Retry)
+            {
+                continue;
+            }
+            auto const fallback = Judge::DefaultAction(game, seat);
+            if (!fallback) { error::raise(fallback.error()); }
+            outcome = game.Resolve(*fallback);
+            if (replay) { replay->Record(game, outcome); }
+        }
+        gate.OnAccepted(game.LastActor());
+
+        if (sampler)
+        {
+            if (auto const fault = sampler->OnStep(game); fault != debug::InvariantFault::None)
+            {
+                std::print("[idiotd] invariant fault: {}\n", debug::to_string(fault));
+            }
+        }
 
-        // TODO (post-MVP): emit Violation envelopes when Step determines Invalid w/ reason.
         BroadcastSnapshots(game, chans, msg_counter++);
     }
 
+    if (replay) { replay->End(game); }
+    gate.Flush();
     std::print("[idiotd] game over\n");
 
     ep->stop_listening();
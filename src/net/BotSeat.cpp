@@ -0,0 +1,274 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include "net/BotSeat.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <variant>
+
+#include "core/Actions.hpp"
+#include "net/codec.hpp"
+
+namespace
+{
+    auto TableRankMask(durak::gen::net::SeatView const* sv) -> std::array<bool, 16>
+    {
+        std::array<bool, 16> have{}; // Rank is <= 14 in classic decks; 16 is safe headroom
+        if (auto const* tbl = sv->table())
+        {
+            for (flatbuffers::uoffset_t i = 0; i < tbl->size(); ++i)
+            {
+                auto const* ts = tbl->Get(i);
+                if (auto const* a = ts->attack()) { have[static_cast<int>(a->rank())] = true; }
+                if (auto const* d = ts->defend()) { have[static_cast<int>(d->rank())] = true; }
+            }
+        }
+        return have;
+    }
+}
+
+namespace durak::net
+{
+    auto ToSnapshot(durak::gen::net::SeatView const* sv,
+                    SnapshotScratch& scratch_out) -> durak::core::GameSnapshot
+    {
+        durak::core::GameSnapshot gs{};
+
+        gs.trump = durak::core::net::FromFbSuit(sv->trump());
+        gs.n_players = sv->n_players();
+        gs.attacker_idx = sv->attacker_idx();
+        gs.defender_idx = sv->defender_idx();
+        gs.phase = durak::core::net::FromFbPhase(sv->phase());
+
+        // Table
+        durak::core::TableViewT table{};
+        if (auto const* tbl = sv->table())
+        {
+            for (std::size_t i = 0; i < static_cast<std::size_t>(tbl->size()) &&
+                 i < durak::core::constants::MaxTableSlots; ++i)
+            {
+                durak::gen::net::TableSlot const* ts = tbl->Get(static_cast<flatbuffers::uoffset_t>(i));
+                if (ts->attack() != nullptr)
+                {
+                    durak::core::CardSP sp = std::make_shared<durak::core::Card>(
+                        durak::core::net::FromFbSuit(ts->attack()->suit()),
+                        durak::core::net::FromFbRank(ts->attack()->rank())
+                    );
+                    gs.table_ranks |= static_cast<std::uint16_t>(1u << static_cast<unsigned>(sp->rank));
+                    scratch_out.atk_owners[i] = sp;
+                    table[i].attack = durak::core::CardWP{sp};
+                }
+                if (ts->defend() != nullptr)
+                {
+                    durak::core::CardSP sp = std::make_shared<durak::core::Card>(
+                        durak::core::net::FromFbSuit(ts->defend()->suit()),
+                        durak::core::net::FromFbRank(ts->defend()->rank())
+                    );
+                    gs.table_ranks |= static_cast<std::uint16_t>(1u << static_cast<unsigned>(sp->rank));
+                    scratch_out.def_owners[i] = sp;
+                    table[i].defend = durak::core::CardWP{sp};
+                }
+            }
+        }
+        gs.table = table;
+
+        // My hand
+        scratch_out.my_owners.clear();
+        if (auto const* hv = sv->my_hand())
+        {
+            scratch_out.my_owners.reserve(hv->size());
+            for (flatbuffers::uoffset_t i = 0; i < hv->size(); ++i)
+            {
+                durak::gen::net::Card const* c = hv->Get(i);
+                durak::core::CardSP sp = std::make_shared<durak::core::Card>(
+                    durak::core::net::FromFbSuit(c->suit()), durak::core::net::FromFbRank(c->rank()));
+                scratch_out.my_owners.push_back(sp);
+                gs.my_hand.push_back(durak::core::CardWP{sp});
+            }
+        }
+
+        // Other counts
+        if (auto const* oc = sv->other_counts())
+        {
+            for (flatbuffers::uoffset_t i = 0; i < oc->size(); ++i)
+            {
+                gs.other_counts.push_back(oc->Get(i));
+            }
+        }
+
+        gs.bout_cap = sv->bout_cap();
+        gs.attacks_used = sv->attacks_used();
+        gs.defender_took = sv->defender_took();
+        gs.deck_count = sv->deck_count();
+        gs.deal_up_to = sv->deal_up_to();
+        gs.unseen_mask = sv->unseen_mask();
+
+        return gs;
+    }
+
+    BotSeat::BotSeat(std::uint64_t rng_seed) :
+        ai_(rng_seed)
+    {
+    }
+
+    auto BotSeat::OnFrame(std::span<std::uint8_t const> frame) -> BotReply
+    {
+        BotReply reply{};
+        if (frame.size() < sizeof(flatbuffers::uoffset_t))
+        {
+            return reply;
+        }
+
+        durak::gen::net::Envelope const* env = durak::gen::net::GetEnvelope(frame.data());
+        if (env == nullptr)
+        {
+            return reply;
+        }
+        reply.seat = seat_;
+
+        switch (env->message_type())
+        {
+        case durak::gen::net::Message::SnapshotMsg:
+            {
+                durak::gen::net::SeatView const* sv = env->message_as_SnapshotMsg()->view();
+                if (sv == nullptr)
+                {
+                    return reply;
+                }
+                seat_ = sv->seat();
+                reply.seat = seat_;
+                view_.assign(frame.begin(), frame.end());
+                reply.verdict = BotVerdict::StateUpdate;
+                return reply;
+            }
+        case durak::gen::net::Message::Violation:
+            // Our last action was refused; the server asks again with a new DecisionRequest.
+            reply.verdict = BotVerdict::Rejected;
+            return reply;
+        case durak::gen::net::Message::DecisionRequest:
+            {
+                durak::gen::net::DecisionRequest const* req = env->message_as_DecisionRequest();
+                if (!seat_ || view_.empty() || req->actor() != *seat_)
+                {
+                    reply.verdict = BotVerdict::NotMyTurn;
+                    return reply;
+                }
+                durak::gen::net::SeatView const* sv =
+                    durak::gen::net::GetEnvelope(view_.data())->message_as_SnapshotMsg()->view();
+                return Decide(sv, req->deadline_epoch_ms());
+            }
+        default:
+            return reply;
+        }
+    }
+
+    auto BotSeat::Decide(durak::gen::net::SeatView const* sv, std::uint64_t const deadline_epoch_ms) -> BotReply
+    {
+        using durak::core::net::CardVal;
+        using durak::core::net::DefPair;
+
+        durak::core::PlyrIdxT const seat = sv->seat();
+        BotReply reply{};
+        reply.seat = seat;
+
+        // 1) Rebuild snapshot for AI and ask it, within the server's deadline (capped at 800 ms)
+        SnapshotScratch scratch{};
+        durak::core::GameSnapshot gs = ToSnapshot(sv, scratch);
+        auto const wall_now = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch());
+        auto const left = std::chrono::milliseconds(
+            std::clamp<std::int64_t>(static_cast<std::int64_t>(deadline_epoch_ms) - wall_now.count(), 0, 800));
+        auto const deadline = std::chrono::steady_clock::now() + left;
+        durak::core::PlayerAction const act = ai_.Play(std::make_shared<durak::core::GameSnapshot>(gs), deadline);
+
+        // 2) Build outbound message — with legality filtering for Attack, and real Pass/Take support
+        bool const built = std::visit([&](auto const& a) -> bool
+        {
+            using T = std::decay_t<decltype(a)>;
+
+            if constexpr (std::is_same_v<T, durak::core::AttackAction>)
+            {
+                //  - if table empty -> send exactly one card (first).
+                //  - else -> only ranks already present on table.
+                auto const mask = TableRankMask(sv);
+                bool const table_empty = (sv->attacks_used() == 0);
+
+                durak::core::InlineVec<CardVal, durak::core::constants::MaxTableSlots> vals;
+
+                if (table_empty)
+                {
+                    if (a.cards.empty()) { return false; }
+                    auto sp = a.cards.front().lock();
+                    if (!sp) { return false; }
+                    vals.push_back(CardVal{sp->suit, sp->rank});
+                }
+                else
+                {
+                    for (durak::core::CardWP const& w : a.cards)
+                    {
+                        auto sp = w.lock();
+                        if (!sp) { continue; }
+                        int const rk = static_cast<int>(sp->rank);
+                        if (rk >= 0 && rk < static_cast<int>(mask.size()) && mask[rk])
+                        {
+                            vals.push_back(CardVal{sp->suit, sp->rank});
+                        }
+                    }
+                    if (vals.empty()) { return false; }
+                }
+
+                reply.bytes = durak::core::net::BuildAction_Attack(
+                    seat, std::span<CardVal const>(vals.data(), vals.size()), next_msg_id_++);
+                return true;
+            }
+            else if constexpr (std::is_same_v<T, durak::core::DefendAction>)
+            {
+                durak::core::InlineVec<DefPair, durak::core::constants::MaxTableSlots> vals;
+
+                for (durak::core::DefendPair const& p : a.pairs)
+                {
+                    auto atk = p.attack.lock();
+                    auto def = p.defend.lock();
+                    if (!atk || !def) { continue; }
+                    vals.push_back(DefPair{
+                        CardVal{atk->suit, atk->rank},
+                        CardVal{def->suit, def->rank}
+                    });
+                }
+                if (vals.empty()) { return false; }
+
+                reply.bytes = durak::core::net::BuildAction_Defend(
+                    seat, std::span<DefPair const>(vals.data(), vals.size()), next_msg_id_++);
+                return true;
+            }
+            else if constexpr (std::is_same_v<T, durak::core::PassAction>)
+            {
+                auto buf = durak::core::net::BuildAction_Pass(seat, next_msg_id_++);
+                reply.bytes.assign(buf.data(), buf.data() + buf.size());
+                return true;
+            }
+            else if constexpr (std::is_same_v<T, durak::core::TakeAction>)
+            {
+                auto buf = durak::core::net::BuildAction_Take(seat, next_msg_id_++);
+                reply.bytes.assign(buf.data(), buf.data() + buf.size());
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }, act);
+
+        if (!built || reply.bytes.empty())
+        {
+            reply.verdict = BotVerdict::BuildFailed;
+            return reply;
+        }
+
+        reply.verdict = BotVerdict::Send;
+        return reply;
+    }
+}
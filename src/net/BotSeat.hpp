@@ -0,0 +1,75 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#ifndef IDIOTGAME_BOTSEAT_HPP
+#define IDIOTGAME_BOTSEAT_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "core/Types.hpp"
+#include "core/State.hpp"
+#include "core/RandomAi.hpp"
+
+#include "generated/flatbuffers/durak_net_generated.h"
+
+namespace durak::net
+{
+    // Owners that must outlive a GameSnapshot rebuilt from a SeatView.
+    // The snapshot references these cards via weak_ptrs.
+    struct SnapshotScratch
+    {
+        std::vector<durak::core::CardSP> my_owners;
+        std::array<durak::core::CardSP, durak::core::constants::MaxTableSlots> atk_owners;
+        std::array<durak::core::CardSP, durak::core::constants::MaxTableSlots> def_owners;
+    };
+
+    // Converts a SeatView into a core::GameSnapshot backed by 'scratch_out'.
+    auto ToSnapshot(durak::gen::net::SeatView const* sv,
+                    SnapshotScratch& scratch_out) -> durak::core::GameSnapshot;
+
+    enum class BotVerdict : uint8_t
+    {
+        Ignored, // not a binary envelope we act on
+        StateUpdate, // SnapshotMsg: view stored, nothing to answer
+        NotMyTurn, // DecisionRequest for another seat, or before we saw any state
+        Rejected, // server sent a Violation: it follows up with a new DecisionRequest
+        Send,
+        BuildFailed
+    };
+
+    struct BotReply
+    {
+        BotVerdict verdict{BotVerdict::Ignored};
+        std::optional<durak::core::PlyrIdxT> seat{};
+        std::vector<std::uint8_t> bytes{};
+    };
+
+    // One headless client seat: owns its own RandomAI and latest view, so many
+    // seats can share a process (and a thread) without interfering with each other.
+    // It keeps the last SnapshotMsg and acts exactly when a DecisionRequest names it.
+    class BotSeat
+    {
+    public:
+        explicit BotSeat(std::uint64_t rng_seed);
+
+        // Feed one inbound binary frame; returns the action to send when it is our turn.
+        auto OnFrame(std::span<std::uint8_t const> frame) -> BotReply;
+
+        auto Seat() const noexcept -> std::optional<durak::core::PlyrIdxT> { return seat_; }
+
+    private:
+        auto Decide(durak::gen::net::SeatView const* sv, std::uint64_t deadline_epoch_ms) -> BotReply;
+
+        durak::core::RandomAI ai_;
+        std::optional<durak::core::PlyrIdxT> seat_{};
+        std::vector<std::uint8_t> view_{}; // last SnapshotMsg envelope
+        std::uint64_t next_msg_id_{1};
+    };
+}
+
+#endif //IDIOTGAME_BOTSEAT_HPP
@@ -27,6 +27,10 @@ namespace durak::net
     {
         DRK_ASSERT(game_ != nullptr, "RemotePlayer used before BindGame()");
 
+        // The host has already sent everyone the state; only the actor learns that it is up.
+        flatbuffers::DetachedBuffer const req = durak::core::net::BuildDecisionRequest(seat_, deadline, next_msg_id_++);
+        chan_->SendBinary(std::span<const std::byte>{reinterpret_cast<const std::byte*>(req.data()), req.size()});
+
         std::vector<uint8_t> frame;
         bool const got = chan_->WaitPopUntil(frame, deadline);
 
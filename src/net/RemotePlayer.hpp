@@ -105,6 +105,7 @@ namespace durak::net
         durak::core::GameImpl* game_{nullptr}; // late-bound
         durak::core::PlyrIdxT seat_{};
         std::shared_ptr<SeatChannel> chan_;
+        std::uint64_t next_msg_id_{1};
     };
 }
 
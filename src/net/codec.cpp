@@ -4,6 +4,7 @@
 #include "Codec.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <utility>
 #include <vector>
@@ -238,7 +239,7 @@ namespace durak::core::net
 
         auto const view = durak::gen::net::CreateSeatView(
             fbb,
-            /*schema_version*/ 1,
+            /*schema_version*/ 2,
             /*seat*/ seat,
             /*n_players*/ static_cast<uint8_t>(snap->n_players),
             /*trump*/ ToFbSuit(snap->trump),
@@ -250,7 +251,10 @@ namespace durak::core::net
             /*other_counts*/ fbb.CreateVector(snap->other_counts),
             /*bout_cap*/ snap->bout_cap,
             /*attacks_used*/ snap->attacks_used,
-            /*defender_took*/ snap->defender_took
+            /*defender_took*/ snap->defender_took,
+            /*deck_count*/ snap->deck_count,
+            /*deal_up_to*/ snap->deal_up_to,
+            /*unseen_mask*/ snap->unseen_mask
         );
 
         auto const sm = durak::gen::net::CreateSnapshotMsg(fbb, msg_id, view);
@@ -276,6 +280,28 @@ namespace durak::core::net
         return fbb.Release();
     }
 
+    // ---------- DecisionRequest (server → actor only) ----------
+
+    auto BuildDecisionRequest(durak::core::PlyrIdxT actor,
+                              std::chrono::steady_clock::time_point deadline,
+                              std::uint64_t msg_id)
+        -> flatbuffers::DetachedBuffer
+    {
+        // Steady deadlines mean nothing to the client; send the same instant on the wall clock.
+        auto const left = deadline - std::chrono::steady_clock::now();
+        auto const wall = std::chrono::system_clock::now() +
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(left);
+        auto const epoch_ms = std::chrono::duration_cast<std::chrono::milliseconds>(wall.time_since_epoch());
+
+        flatbuffers::FlatBufferBuilder fbb(64);
+        auto const req = durak::gen::net::CreateDecisionRequest(
+            fbb, msg_id, actor, static_cast<std::uint64_t>(std::max<std::int64_t>(epoch_ms.count(), 0)));
+        auto const env = durak::gen::net::CreateEnvelope(
+            fbb, durak::gen::net::Message::DecisionRequest, req.Union());
+        fbb.Finish(env);
+        return fbb.Release();
+    }
+
     // ---------- Builders (client → server) ----------
 
     auto BuildAction_Attack(durak::core::PlyrIdxT actor,
@@ -386,18 +412,19 @@ namespace durak::core::net
             DecodedAction out{};
             out.actor = static_cast<durak::core::PlyrIdxT>(a->actor());
 
-            std::vector<durak::core::CardWP> w;
+            durak::core::AttackAction act{};
             if (auto const* v = a->cards())
             {
-                w.reserve(v->size());
+                if (v->size() > act.cards.capacity())
+                    return std::unexpected(ParseError{"too many attack cards"});
                 for (auto const* fb_c : *v)
                 {
                     auto const [s, r] = FbToSuitRank(fb_c);
                     durak::core::Card probe{s, r};
-                    w.push_back(g.FindFromHand(out.actor, probe));
+                    act.cards.push_back(g.FindFromHand(out.actor, probe));
                 }
             }
-            out.action = durak::core::AttackAction{std::move(w)};
+            out.action = std::move(act);
             return out;
         }
 
@@ -407,10 +434,11 @@ namespace durak::core::net
             DecodedAction out{};
             out.actor = static_cast<durak::core::PlyrIdxT>(d->actor());
 
-            std::vector<durak::core::DefendPair> pairs;
+            durak::core::DefendAction act{};
             if (auto const* v = d->pairs())
             {
-                pairs.reserve(v->size());
+                if (v->size() > act.pairs.capacity())
+                    return std::unexpected(ParseError{"too many defend pairs"});
                 for (auto const* fb_p : *v)
                 {
                     auto const [sa, ra] = FbToSuitRank(fb_p->attack());
@@ -419,13 +447,13 @@ namespace durak::core::net
                     durak::core::Card atk{sa, ra};
                     durak::core::Card def{sd, rd};
 
-                    pairs.push_back(durak::core::DefendPair{
+                    act.pairs.push_back(durak::core::DefendPair{
                         .attack = g.FindFromAtkTable(atk),
                         .defend = g.FindFromHand(out.actor, def)
                     });
                 }
             }
-            out.action = durak::core::DefendAction{std::move(pairs)};
+            out.action = std::move(act);
             return out;
         }
 
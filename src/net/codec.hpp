@@ -3,6 +3,7 @@
 #define IDIOTGAME_CODEC_HPP
 
 #include <cstddef>   // std::byte
+#include <chrono>
 #include <cstdint>
 #include <span>
 #include <variant>
@@ -76,6 +77,12 @@ namespace durak::core::net
                         std::uint64_t msg_id)
         -> flatbuffers::DetachedBuffer;
 
+    // Tells 'actor' (and only it) that it is up; the state itself travels in the SnapshotMsg sent before.
+    auto BuildDecisionRequest(durak::core::PlyrIdxT actor,
+                              std::chrono::steady_clock::time_point deadline,
+                              std::uint64_t msg_id)
+        -> flatbuffers::DetachedBuffer;
+
     // Attack: provide weak refs from the actor’s hand
     auto BuildAction_Attack(durak::core::PlyrIdxT actor,
                             std::span<durak::core::CardWP const> cards,
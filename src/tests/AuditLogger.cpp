@@ -0,0 +1,212 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../core/ClassicRules.hpp"
+#include "../core/Game.hpp"
+#include "../core/RandomAi.hpp"
+#include "../debug/AuditLogger.hpp"
+#include "../debug/Inspector.hpp"
+#include "../debug/RecordingPlayer.hpp"
+
+using namespace durak::core;
+using namespace durak::core::debug;
+
+namespace
+{
+    // The synchronous formatter AuditLogger replaced, reading the live game at each call.
+    struct LegacyLog
+    {
+        std::string text;
+
+        static auto Suit1(Suit const s) -> std::string_view
+        {
+            switch (s)
+            {
+            case Suit::Clubs: return "C";
+            case Suit::Diamonds: return "D";
+            case Suit::Hearts: return "H";
+            case Suit::Spades: return "S";
+            }
+            return "?";
+        }
+
+        static auto Card1(CardWP const& w) -> std::string
+        {
+            static constexpr std::string_view ranks = "23456789TJQKA";
+            CardSP const c = w.lock();
+            return std::format("{}{}", ranks[static_cast<size_t>(c->rank)], Suit1(c->suit));
+        }
+
+        static auto Action1(PlayerAction const& a) -> std::string
+        {
+            return std::visit([]<typename T>(T const& act) -> std::string
+            {
+                std::string body;
+                if constexpr (std::is_same_v<T, AttackAction>)
+                {
+                    for (CardWP const& w : act.cards) body += (body.empty() ? "" : ",") + Card1(w);
+                    return std::format("Attack[{}]", body);
+                }
+                else if constexpr (std::is_same_v<T, DefendAction>)
+                {
+                    for (DefendPair const& p : act.pairs)
+                        body += std::format("{}{}/{}", body.empty() ? "" : ",", Card1(p.attack), Card1(p.defend));
+                    return std::format("Defend{{{}}}", body);
+                }
+                else if constexpr (std::is_same_v<T, TransferAction>)
+                    return std::format("Transfer({})", Card1(act.card));
+                else if constexpr (std::is_same_v<T, PassAction>)
+                    return "Pass";
+                else
+                    return "Take";
+            }, a);
+        }
+
+        auto Start(GameImpl const& g, uint64_t const seed) -> void
+        {
+            text += std::format("Seed={}\nTrump={}\nPlayers={}\n", seed, Suit1(g.Trump()), g.PlayerCount());
+        }
+
+        auto Turn(GameImpl const& g, GameSnapshot const& s, uint8_t const actor, PlayerAction const& a) -> void
+        {
+            std::string table;
+            for (TableSlotView const& slot : s.table)
+            {
+                if (slot.attack.expired() && slot.defend.expired()) continue;
+                table += std::format("{}{}/{}", table.empty() ? "" : ",",
+                                     slot.attack.expired() ? "--" : Card1(slot.attack),
+                                     slot.defend.expired() ? "--" : Card1(slot.defend));
+            }
+            auto const all = Inspector::Gather(g);
+            text += std::format("Turn actor=P{} phase={} atk={} def={} table=[{}] deck={} discard={}\n",
+                                actor, s.phase == Phase::Attacking ? "A" : "D", s.attacker_idx, s.defender_idx,
+                                table, all.deck.size(), all.discard.size());
+            text += std::format("Action: {}\n", Action1(a));
+        }
+
+        auto Outcome(MoveOutcome const m) -> void
+        {
+            char const* const txt = m == MoveOutcome::Applied
+                                        ? "Applied"
+                                        : m == MoveOutcome::RoundEnded
+                                        ? "RoundEnded"
+                                        : m == MoveOutcome::GameEnded
+                                        ? "GameEnded"
+                                        : "Invalid";
+            text += std::format("Outcome: {}\n", txt);
+        }
+
+        auto Cleanup(GameImpl const& g) -> void
+        {
+            std::string body;
+            for (uint8_t i = 0; i < g.PlayerCount(); ++i)
+                body += std::format("{}{}:{}", i ? "," : "", i, g.SnapshotFor(i)->my_hand.size());
+            auto const all = Inspector::Gather(g);
+            text += std::format("Cleanup: handsizes=[{}] next_atk=P{} next_def=P{} deck={} discard={}\n",
+                                body, g.Attacker(), g.Defender(), all.deck.size(), all.discard.size());
+        }
+
+        auto End(GameImpl const& g) -> void
+        {
+            int loser = -1;
+            for (uint8_t i = 0; i < g.PlayerCount() && loser == -1; ++i)
+                if (!g.SnapshotFor(i)->my_hand.empty()) loser = i;
+            text += std::format("Loser={}\n", loser);
+        }
+    };
+
+    auto ReadAll(std::filesystem::path const& path) -> std::string
+    {
+        std::ifstream in(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+}
+
+// A seeded selfplay transcript is byte-identical to what the synchronous logger wrote.
+TEST(AuditLogger, Matches_The_Synchronous_Formatter)
+{
+    namespace fs = std::filesystem;
+    fs::create_directories("_artifacts");
+
+    for (uint64_t const seed : {111ull, 222ull, 7ull})
+    {
+        for (uint8_t const players : {2, 4})
+        {
+            std::vector<std::unique_ptr<Player>> ps;
+            for (uint8_t i = 0; i < players; ++i) ps.emplace_back(std::make_unique<RandomAI>(seed + 1 + i));
+            ps = WrapRecording(ps);
+            Config const cfg{.n_players = players, .deal_up_to = 6, .deck36 = players == 2, .seed = seed};
+            GameImpl game(cfg, std::make_unique<ClassicRules>(), std::move(ps));
+
+            fs::path const path = std::format("_artifacts/audit_{}p_{}.log", players, seed);
+            LegacyLog legacy;
+            uint64_t dropped = 0;
+            {
+                AuditLogger log(path.string());
+                log.start(game, seed);
+                legacy.Start(game, seed);
+                for (MoveOutcome out = MoveOutcome::Applied; out != MoveOutcome::GameEnded;)
+                {
+                    PlyrIdxT const actor = game.CurrentActor();
+                    auto const snap = game.SnapshotFor(actor);
+                    out = game.Step();
+                    PlayerAction const& act = AsRecording(game.PlayerAt(actor))->Last();
+
+                    log.turn(game, *snap, actor, act);
+                    legacy.Turn(game, *snap, actor, act);
+                    log.outcome(out);
+                    legacy.Outcome(out);
+                    if (out == MoveOutcome::RoundEnded)
+                    {
+                        log.cleanup(game);
+                        legacy.Cleanup(game);
+                    }
+                }
+                log.end(game);
+                legacy.End(game);
+                dropped = log.dropped();
+            }
+
+            ASSERT_EQ(dropped, 0u) << "one game fits the queue";
+            EXPECT_EQ(ReadAll(path), legacy.text) << path;
+        }
+    }
+}
+
+// Bursts past the queue never block the caller; every lost record is accounted for in the file.
+TEST(AuditLogger, Drops_Are_Counted_Not_Waited_On)
+{
+    namespace fs = std::filesystem;
+    fs::create_directories("_artifacts");
+    fs::path const path = "_artifacts/audit_drops.log";
+
+    constexpr uint64_t Records = 20'000;
+    uint64_t dropped = 0;
+    {
+        AuditLogger log(path.string());
+        for (uint64_t i = 0; i < Records; ++i) log.outcome(MoveOutcome::Applied);
+        dropped = log.dropped();
+    }
+
+    std::istringstream lines(ReadAll(path));
+    uint64_t written = 0;
+    uint64_t reported = 0;
+    for (std::string line; std::getline(lines, line);)
+    {
+        if (line == "Outcome: Applied") ++written;
+        else if (line.starts_with("Dropped=")) reported += std::stoull(line.substr(8));
+        else ADD_FAILURE() << line;
+    }
+    EXPECT_EQ(reported, dropped);
+    EXPECT_EQ(written + dropped, Records);
+}
@@ -0,0 +1,187 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <bit>
+
+#include "../core/ClassicPolicy.hpp"
+#include "../core/ClassicRules.hpp"
+#include "../core/RandomAi.hpp"
+#include "../core/Util.hpp"
+
+using namespace durak::core;
+
+static_assert(RulesPolicy<ClassicPolicy>);
+
+namespace
+{
+    auto CardOf(CardWP const& w) -> Card
+    {
+        CardSP const c = w.lock();
+        return Card{c->suit, c->rank};
+    }
+
+    // Re-points an action chosen on one game at the same cards of another.
+    auto Remap(PlayerAction const& a, GameImpl const& to) -> PlayerAction
+    {
+        PlyrIdxT const actor = to.CurrentActor();
+        return std::visit([&]<typename T>(T const& act) -> PlayerAction
+        {
+            if constexpr (std::is_same_v<T, AttackAction>)
+            {
+                AttackAction out{};
+                for (CardWP const& w : act.cards) out.cards.push_back(to.FindFromHand(actor, CardOf(w)));
+                return out;
+            }
+            else if constexpr (std::is_same_v<T, DefendAction>)
+            {
+                DefendAction out{};
+                for (DefendPair const& p : act.pairs)
+                {
+                    out.pairs.push_back(DefendPair{to.FindFromAtkTable(CardOf(p.attack)),
+                                                   to.FindFromHand(actor, CardOf(p.defend))});
+                }
+                return out;
+            }
+            else
+            {
+                return act;
+            }
+        }, a);
+    }
+}
+
+// The inlined policy path and the virtual adapter must make identical decisions, violations included.
+TEST(BasicGame, Matches_Virtual_Rules)
+{
+    for (std::uint64_t seed = 1; seed <= 30; ++seed)
+    {
+        Config cfg{.n_players = static_cast<uint32_t>(2 + seed % 5), .deal_up_to = 6, .deck36 = seed % 2 == 0,
+                   .seed = seed};
+        ClassicGame fast(cfg);
+        GameImpl slow(cfg, std::make_unique<ClassicRules>());
+        RandomAI bot(seed);
+
+        MoveOutcome out = MoveOutcome::Applied;
+        for (int step = 0; step < 3000 && out != MoveOutcome::GameEnded; ++step)
+        {
+            ASSERT_EQ(fast.Capture(), slow.Capture()) << "seed " << seed << " step " << step;
+
+            PlyrIdxT const actor = fast.CurrentActor();
+            // Every fifth turn try the move the phase does not allow, to compare rejections too
+            PlayerAction const action = (step % 5 == 4)
+                                            ? (fast.PhaseNow() == Phase::Defending
+                                                   ? PlayerAction{PassAction{}}
+                                                   : PlayerAction{TakeAction{}})
+                                            : bot.Play(fast.SnapshotFor(actor), std::chrono::steady_clock::now());
+
+            auto const a = fast.TryResolve(action);
+            auto const b = slow.TryResolve(Remap(action, slow));
+            ASSERT_TRUE(a.has_value());
+            ASSERT_TRUE(b.has_value());
+            ASSERT_EQ(*a, *b);
+            ASSERT_EQ(fast.LastViolation().has_value(), slow.LastViolation().has_value());
+            if (fast.LastViolation())
+            {
+                EXPECT_EQ(fast.LastViolation()->code, slow.LastViolation()->code);
+            }
+            out = *a;
+        }
+        EXPECT_EQ(out, MoveOutcome::GameEnded) << "seed " << seed;
+    }
+}
+
+static_assert(DeckTemplate<true>.size() == 36 && DeckTemplate<false>.size() == 52);
+static_assert(std::popcount(DeckMask<true>) == 36 && (DeckMask<true> & ~DeckMask<false>) == 0);
+
+// The fixed heads-up shape only folds seat arithmetic; play must match the dynamic engine card for card.
+TEST(BasicGame, HeadsUp_Shape_Matches_Dynamic)
+{
+    for (std::uint64_t seed = 1; seed <= 40; ++seed)
+    {
+        Config const cfg{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = seed};
+        ClassicHeadsUpGame fast(cfg);
+        ClassicGame slow(cfg);
+        RandomAI bot(seed);
+
+        MoveOutcome out = MoveOutcome::Applied;
+        for (int step = 0; step < 3000 && out != MoveOutcome::GameEnded; ++step)
+        {
+            ASSERT_EQ(fast.Capture(), slow.Capture()) << "seed " << seed << " step " << step;
+            auto const snap = fast.SnapshotFor(fast.CurrentActor());
+            PlayerAction const action = bot.Play(snap, std::chrono::steady_clock::now());
+            auto const a = fast.TryResolve(action);
+            auto const b = slow.TryResolve(Remap(action, slow));
+            ASSERT_TRUE(a.has_value() && b.has_value());
+            ASSERT_EQ(*a, *b);
+            out = *a;
+        }
+        EXPECT_EQ(out, MoveOutcome::GameEnded) << "seed " << seed;
+    }
+}
+
+TEST(BasicGame, Dispatch_Picks_Fixed_Shape)
+{
+    auto is_fixed = [](Config const& c)
+    {
+        return DispatchShape(c, []<class S>(S) { return std::is_same_v<S, HeadsUp36>; });
+    };
+    EXPECT_TRUE(is_fixed(Config{.n_players = 2, .deck36 = true, .seed = 1}));
+    EXPECT_FALSE(is_fixed(Config{.n_players = 2, .deck36 = false, .seed = 1}));
+    EXPECT_FALSE(is_fixed(Config{.n_players = 3, .deck36 = true, .seed = 1}));
+}
+
+// Seat dispatch fixes heads-up games whatever their deck; a config with the 52-card deck still fits.
+TEST(BasicGame, Seat_Dispatch_Ignores_Deck)
+{
+    auto is_fixed = [](size_t const n)
+    {
+        return DispatchSeats(n, []<class S>(S) { return !std::is_same_v<S, DynamicShape>; });
+    };
+    EXPECT_TRUE(is_fixed(2));
+    EXPECT_FALSE(is_fixed(3));
+
+    Config const deck52{.n_players = 2, .deal_up_to = 6, .deck36 = false, .seed = 1};
+    BasicClassicGame<FixedSeats<2>> g(deck52);
+    EXPECT_EQ(g.DeckSize(), 52u - 12u);
+}
+
+TEST(BasicGame, Factory_Picks_Fixed_Shape)
+{
+    using HeadsUpRules = PolicyRules<BasicClassicPolicy<HeadsUp36>>;
+    auto const fixed = MakeClassicRules(Config{.n_players = 2, .deck36 = true, .seed = 1});
+    auto const dynamic = MakeClassicRules(Config{.n_players = 3, .deck36 = true, .seed = 1});
+    EXPECT_NE(dynamic_cast<HeadsUpRules const*>(fixed.get()), nullptr);
+    EXPECT_NE(dynamic_cast<ClassicRules const*>(dynamic.get()), nullptr);
+}
+
+// Validate resolves an attack to hand positions (highest first) and the free slots in card order.
+TEST(BasicGame, Validate_Plans_Positions)
+{
+    ClassicGame game(Config{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = 3});
+    StateImage img{};
+    img.hands = {{4, 5, 17}, {30, 31, 44}}; // 6H 7H 6D | 6C 7C 7S
+    img.table_atk.fill(StateImage::NoCard);
+    img.table_def.fill(StateImage::NoCard);
+    img.trump = Suit::Spades;
+    game.Restore(img);
+
+    AttackAction atk{{game.FindFromHand(0, Card{Suit::Diamonds, Rank::Six}),
+                      game.FindFromHand(0, Card{Suit::Hearts, Rank::Six})}};
+    auto const plan = ClassicPolicy::Validate(game, atk);
+    ASSERT_TRUE(plan.has_value());
+    ASSERT_EQ(plan->placements.size(), 2u);
+    EXPECT_EQ(plan->placements[0].hand_idx, 2u);
+    EXPECT_EQ(plan->placements[0].slot, 0u);
+    EXPECT_EQ(plan->placements[1].hand_idx, 0u);
+    EXPECT_EQ(plan->placements[1].slot, 1u);
+    EXPECT_EQ(plan->pin_cap, std::optional<uint8_t>{3});
+
+    ASSERT_EQ(game.Resolve(atk), MoveOutcome::Applied);
+    StateImage const after = game.Capture();
+    EXPECT_EQ(after.hands[0], (std::vector<uint8_t>{5}));
+    EXPECT_EQ(after.table_atk[0], 17);
+    EXPECT_EQ(after.table_atk[1], 4);
+    EXPECT_EQ(game.BoutCap(), 3);
+}
@@ -0,0 +1,93 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../core/BatchSim.hpp"
+#include "../core/ClassicRules.hpp"
+#include "../core/CompactMove.hpp"
+#include "../core/Game.hpp"
+
+using namespace durak::core;
+
+namespace
+{
+    auto ExpectSameState(BatchSim const& sim, size_t const lane, GameImpl const& g, std::string const& where) -> void
+    {
+        ZoneMasks const& m = g.Masks();
+        for (PlyrIdxT s = 0; s < g.PlayerCount(); ++s) EXPECT_EQ(sim.Hand(lane, s), m.hands[s]) << where;
+        EXPECT_EQ(sim.Table(lane), m.table) << where;
+        EXPECT_EQ(sim.Discard(lane), m.discard) << where;
+        EXPECT_EQ(sim.DeckSize(lane), g.DeckSize()) << where;
+        EXPECT_EQ(sim.Attacker(lane), g.Attacker()) << where;
+        EXPECT_EQ(sim.Defender(lane), g.Defender()) << where;
+        EXPECT_EQ(sim.PhaseOf(lane), g.PhaseNow()) << where;
+        EXPECT_EQ(sim.BoutCap(lane), g.BoutCap()) << where;
+    }
+}
+
+// Every lane's move, replayed through GameImpl, is accepted and leads to the same state, to the end.
+TEST(BatchSim, Lanes_Match_GameImpl)
+{
+    for (uint8_t const players : {2, 3, 4, 6})
+    {
+        for (bool const deck36 : {true, false})
+        {
+            BatchSim sim(players, 6);
+            std::vector<std::unique_ptr<GameImpl>> games;
+            for (size_t l = 0; l < BatchSim::Lanes; ++l)
+            {
+                Config const cfg{.n_players = players, .deal_up_to = 6, .deck36 = deck36, .seed = 1000 + l};
+                games.push_back(std::make_unique<GameImpl>(cfg, std::make_unique<ClassicRules>()));
+                sim.Load(l, games[l]->Capture());
+            }
+
+            size_t live = BatchSim::Lanes;
+            for (int step = 0; live != 0; ++step)
+            {
+                ASSERT_LT(step, 2000) << "greedy games should end";
+                std::vector<bool> before(BatchSim::Lanes);
+                for (size_t l = 0; l < BatchSim::Lanes; ++l) before[l] = sim.Live(l);
+                live = sim.Step();
+
+                for (size_t l = 0; l < BatchSim::Lanes; ++l)
+                {
+                    if (!before[l]) continue;
+                    std::string const where = std::to_string(players) + "p lane " + std::to_string(l) +
+                        " step " + std::to_string(step);
+                    GameImpl& g = *games[l];
+                    auto const out = g.TryResolve(ToAction(g, g.CurrentActor(), sim.LastMove(l)));
+                    ASSERT_TRUE(out.has_value()) << where;
+                    ASSERT_NE(*out, MoveOutcome::Invalid) << where;
+                    ExpectSameState(sim, l, g, where);
+                    ASSERT_EQ(*out == MoveOutcome::GameEnded, !sim.Live(l)) << where;
+                }
+            }
+
+            for (size_t l = 0; l < BatchSim::Lanes; ++l)
+            {
+                PlyrIdxT fool = BatchSim::NoSeat;
+                for (PlyrIdxT s = 0; s < players; ++s)
+                    if (games[l]->HandSize(s) != 0) fool = s;
+                EXPECT_EQ(sim.Loser(l), fool);
+            }
+        }
+    }
+}
+
+TEST(BatchSim, Run_Leaves_Unloaded_Lanes_Alone)
+{
+    Config const cfg{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = 7};
+    GameImpl g(cfg, std::make_unique<ClassicRules>());
+
+    BatchSim sim(2, 6);
+    sim.Load(3, g.Capture());
+    EXPECT_EQ(sim.Run(1000), 0u);
+    EXPECT_FALSE(sim.Live(3));
+    EXPECT_EQ(sim.Hand(0, 0), 0u);
+    EXPECT_EQ(sim.Loser(0), BatchSim::NoSeat);
+}
@@ -0,0 +1,86 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <bit>
+#include <random>
+
+#include "../core/BeliefState.hpp"
+#include "../core/ClassicRules.hpp"
+#include "../core/Game.hpp"
+#include "../core/RandomAi.hpp"
+
+using namespace durak::core;
+
+namespace
+{
+    auto MaskOf(std::vector<uint8_t> const& ids) -> uint64_t
+    {
+        uint64_t m{};
+        for (uint8_t const id : ids) m |= uint64_t{1} << id;
+        return m;
+    }
+
+    // Observes every step (dense) or only seat 0's own turns (sparse), checking the belief against the truth.
+    auto RunAndCheck(std::uint64_t seed, uint32_t players, bool dense) -> int
+    {
+        Config cfg{.n_players = players, .deal_up_to = 6, .deck36 = true, .seed = seed};
+        std::vector<std::unique_ptr<Player>> ps;
+        for (uint32_t i = 0; i < players; ++i) ps.emplace_back(std::make_unique<RandomAI>(seed * 7 + i));
+        GameImpl game(cfg, std::make_unique<ClassicRules>(), std::move(ps));
+
+        BeliefState belief;
+        std::mt19937_64 rng{seed};
+        int known_seen = 0;
+
+        for (int step = 0; step < 2000; ++step)
+        {
+            if (dense || game.CurrentActor() == 0)
+            {
+                auto const snap = game.SnapshotFor(0);
+                belief.Observe(*snap, 0);
+
+                uint64_t hidden{};
+                for (PlyrIdxT s = 1; s < players; ++s)
+                {
+                    // Never claims a card the seat doesn't hold
+                    EXPECT_EQ(belief.Known(s) & ~game.Masks().hands[s], 0u) << "seat " << int(s) << " step " << step;
+                    known_seen += std::popcount(belief.Known(s));
+                    hidden |= game.Masks().hands[s];
+                }
+                EXPECT_EQ(belief.Unseen(), hidden | game.Masks().deck);
+
+                StateImage img = game.Capture();
+                belief.Sample(rng, img);
+                uint64_t dealt{MaskOf(img.deck)};
+                EXPECT_EQ(img.deck.size(), game.DeckSize());
+                for (PlyrIdxT s = 1; s < players; ++s)
+                {
+                    uint64_t const h = MaskOf(img.hands[s]);
+                    EXPECT_EQ(img.hands[s].size(), game.HandSize(s));
+                    EXPECT_EQ(h & belief.Known(s), belief.Known(s));
+                    EXPECT_EQ(h & dealt, 0u);
+                    dealt |= h;
+                }
+                EXPECT_EQ(dealt, belief.Unseen());
+            }
+            if (game.Step() == MoveOutcome::GameEnded) break;
+        }
+        return known_seen;
+    }
+}
+
+TEST(BeliefState, Tracks_Taken_Cards_Every_Step)
+{
+    int known = 0;
+    for (std::uint64_t seed = 1; seed <= 20; ++seed) known += RunAndCheck(seed, 2, true);
+    EXPECT_GT(known, 0); // RandomAI takes often enough that something is always deduced
+}
+
+TEST(BeliefState, Sparse_Observations_Multiplayer)
+{
+    int known = 0;
+    for (std::uint64_t seed = 1; seed <= 20; ++seed) known += RunAndCheck(seed, 4, false);
+    EXPECT_GT(known, 0);
+}
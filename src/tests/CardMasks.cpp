@@ -0,0 +1,61 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <bit>
+
+#include "../core/CardMasks.hpp"
+#include "../core/Util.hpp"
+
+using namespace durak::core;
+
+static_assert(masks::Beats(12, 0, Suit::Spades)); // AH beats 2H
+static_assert(!masks::Beats(0, 12, Suit::Spades));
+static_assert(masks::Beats(39, 12, Suit::Spades)); // 2S trumps AH
+static_assert(!masks::Beats(12, 39, Suit::Spades));
+static_assert(masks::CardsOfRanks(masks::RanksOf(masks::CardBit(4))) == masks::RankCards[4]);
+
+// The table agrees with the suit/rank rule for every attack, defence and trump.
+TEST(CardMasks, Beaters_Match_Pairwise_Rule)
+{
+    for (uint8_t t = 0; t < 4; ++t)
+    {
+        Suit const trump = static_cast<Suit>(t);
+        for (uint8_t a = 0; a < constants::MaxDeckSize; ++a)
+        {
+            for (uint8_t d = 0; d < constants::MaxDeckSize; ++d)
+            {
+                Suit const sa = util::UIDToSuit(a);
+                Suit const sd = util::UIDToSuit(d);
+                bool const expect = sd == sa ? util::UIDToRank(d) > util::UIDToRank(a) : sd == trump;
+                EXPECT_EQ(masks::Beats(d, a, trump), expect) << int(d) << " on " << int(a) << " trump " << int(t);
+            }
+        }
+    }
+}
+
+TEST(CardMasks, Computed_Beaters_Match_Table)
+{
+    for (uint8_t t = 0; t < 4; ++t)
+    {
+        for (uint8_t a = 0; a < constants::MaxDeckSize; ++a)
+        {
+            EXPECT_EQ(masks::BeatersOf(masks::CardBit(a), masks::SuitCards[t]), masks::BeatersTable[t][a])
+                << int(a) << " trump " << int(t);
+        }
+    }
+}
+
+TEST(CardMasks, Rank_Sets_Round_Trip)
+{
+    for (uint32_t ranks = 0; ranks < (1u << 13); ++ranks)
+    {
+        uint64_t const cards = masks::CardsOfRanks(static_cast<uint16_t>(ranks));
+        ASSERT_EQ(std::popcount(cards), 4 * std::popcount(ranks));
+        ASSERT_EQ(masks::RanksOf(cards), ranks);
+    }
+    uint64_t all{};
+    for (uint64_t const s : masks::SuitCards) all |= s;
+    EXPECT_EQ(all, (uint64_t{1} << constants::MaxDeckSize) - 1);
+}
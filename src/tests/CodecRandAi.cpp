@@ -5,6 +5,7 @@
 #include <vector>
 #include <expected>
 #include <cstddef>
+#include <chrono>
 
 #include "../core/Types.hpp"
 #include "../core/Actions.hpp"
@@ -14,8 +15,10 @@
 #include "../core/Game.hpp"
 #include "../core/RandomAi.hpp"
 #include "../core/Exception.hpp"
+#include "../core/IsmctsAi.hpp"
 
 #include "../net/Codec.hpp"  // BuildSnapshot + DecodePlayerAction
+#include "../net/BotSeat.hpp"
 #include "../generated/flatbuffers/durak_net_generated.h"
 
 using namespace durak::core;
@@ -394,4 +397,67 @@ TEST(Codec_RandomAI, BuildSnapshot_MatchesAuthoritativeState)
             EXPECT_EQ(fb->defend(), nullptr);
         }
     }
-}
\ No newline at end of file
+}
+
+// Snapshots only update a bot's view; it acts when (and only when) a DecisionRequest names its seat.
+TEST(Codec_RandomAI, DecisionRequest_Drives_BotSeat)
+{
+    GameImpl game = MakeGameWithRandomAIs({0x5EED5EEDULL, 0x1111ULL, 0x2222ULL});
+    AdvanceNSteps(game, 3);
+    const PlyrIdxT actor = game.CurrentActor();
+    const PlyrIdxT other = static_cast<PlyrIdxT>(1 - actor);
+
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    flatbuffers::DetachedBuffer req = durak::core::net::BuildDecisionRequest(actor, deadline, /*msg_id*/7);
+    durak::gen::net::Envelope const* env = durak::gen::net::GetEnvelope(req.data());
+    ASSERT_EQ(env->message_type(), durak::gen::net::Message::DecisionRequest);
+    EXPECT_EQ(env->message_as_DecisionRequest()->actor(), actor);
+    auto const wall_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    auto const ahead = static_cast<int64_t>(env->message_as_DecisionRequest()->deadline_epoch_ms()) - wall_ms;
+    EXPECT_GT(ahead, 500);
+    EXPECT_LE(ahead, 1000);
+
+    durak::net::BotSeat bot(99);
+    EXPECT_EQ(bot.OnFrame({req.data(), req.size()}).verdict, durak::net::BotVerdict::NotMyTurn); // no view yet
+
+    flatbuffers::DetachedBuffer snap = BuildSnapshot(game, actor, /*msg_id*/8);
+    EXPECT_EQ(bot.OnFrame({snap.data(), snap.size()}).verdict, durak::net::BotVerdict::StateUpdate);
+
+    flatbuffers::DetachedBuffer not_us = durak::core::net::BuildDecisionRequest(other, deadline, /*msg_id*/9);
+    EXPECT_EQ(bot.OnFrame({not_us.data(), not_us.size()}).verdict, durak::net::BotVerdict::NotMyTurn);
+
+    durak::net::BotReply const reply = bot.OnFrame({req.data(), req.size()});
+    ASSERT_EQ(reply.verdict, durak::net::BotVerdict::Send);
+    std::span<const std::byte> bytes{reinterpret_cast<const std::byte*>(reply.bytes.data()), reply.bytes.size()};
+    std::expected<durak::core::net::DecodedAction, durak::core::net::ParseError> res = DecodePlayerAction(game, bytes);
+    ASSERT_TRUE(res.has_value());
+    EXPECT_EQ(res->actor, actor);
+}
+
+// A decoded SeatView carries what a determinizing bot needs, so ISMCTS does not fall back to random.
+TEST(Codec_RandomAI, Decoded_Snapshot_Can_Determinize)
+{
+    GameImpl game = MakeGameWithRandomAIs({0xD1CEULL, 0xBEEFULL, 0xCAFEULL});
+    for (int step = 0; step < 12; ++step)
+    {
+        const PlyrIdxT seat = game.CurrentActor();
+        std::shared_ptr<const GameSnapshot> live = game.SnapshotFor(seat);
+
+        flatbuffers::DetachedBuffer buf = BuildSnapshot(game, seat, /*msg_id*/step);
+        durak::gen::net::SnapshotMsg const* sm = durak::gen::net::GetEnvelope(buf.data())->message_as_SnapshotMsg();
+        ASSERT_NE(sm, nullptr);
+        durak::gen::net::SeatView const* sv = sm->view();
+        ASSERT_NE(sv, nullptr);
+
+        durak::net::SnapshotScratch scratch;
+        GameSnapshot const gs = durak::net::ToSnapshot(sv, scratch);
+        EXPECT_EQ(gs.deck_count, live->deck_count);
+        EXPECT_EQ(gs.deal_up_to, live->deal_up_to);
+        EXPECT_EQ(gs.unseen_mask, live->unseen_mask);
+        EXPECT_TRUE(IsmctsAI::CanDeterminize(*live));
+        EXPECT_TRUE(IsmctsAI::CanDeterminize(gs));
+
+        if (game.Step() == MoveOutcome::GameEnded) break;
+    }
+}
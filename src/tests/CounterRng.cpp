@@ -0,0 +1,74 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+
+#include "../core/ClassicPolicy.hpp"
+#include "../core/CounterRng.hpp"
+#include "../core/RandomAi.hpp"
+
+using namespace durak::core;
+
+static_assert(CounterRng{5}() == CounterRng{5}());
+static_assert(CounterRng::SeedFor(1, 2, 0) != CounterRng::SeedFor(1, 2, 1));
+
+// Jumping is the same as drawing: any position of any stream is reachable without the ones before it.
+TEST(CounterRng, Discard_Matches_Drawing)
+{
+    CounterRng walked{CounterRng::SeedFor(42, 1000, 3)};
+    for (int i = 0; i < 977; ++i) walked();
+
+    CounterRng jumped{CounterRng::SeedFor(42, 1000, 3)};
+    jumped.discard(977);
+    EXPECT_EQ(jumped, walked);
+    EXPECT_EQ(jumped(), walked());
+    EXPECT_EQ(CounterRng(CounterRng::SeedFor(42, 1000, 3), 978), walked);
+}
+
+TEST(CounterRng, Streams_Are_Distinct)
+{
+    std::set<uint64_t> firsts;
+    for (uint64_t game = 0; game < 64; ++game)
+    {
+        for (uint64_t seat = 0; seat < constants::MaxPlayers; ++seat)
+        {
+            firsts.insert(CounterRng{CounterRng::SeedFor(7, game, seat)}());
+        }
+        firsts.insert(CounterRng{CounterRng::SeedFor(7, game, CounterRng::DeckStream)}());
+    }
+    EXPECT_EQ(firsts.size(), 64u * (constants::MaxPlayers + 1));
+}
+
+// Counter-shuffled deals and counter-driven bots replay bit for bit from their seeds.
+TEST(CounterRng, Games_Reproduce)
+{
+    auto play = [](uint64_t const game) -> StateImage
+    {
+        Config cfg{.n_players = 3, .deal_up_to = 6, .deck36 = false,
+                   .seed = CounterRng::SeedFor(99, game, CounterRng::DeckStream), .counter_rng = true};
+        ClassicGame g(cfg);
+        std::vector<std::unique_ptr<CounterRandomAI>> bots;
+        for (uint64_t seat = 0; seat < cfg.n_players; ++seat)
+        {
+            bots.push_back(std::make_unique<CounterRandomAI>(CounterRng::SeedFor(99, game, seat)));
+        }
+
+        for (int ply = 0; ply < 3000; ++ply)
+        {
+            PlyrIdxT const actor = g.CurrentActor();
+            auto const out = g.TryResolve(bots[actor]->Play(g.SnapshotFor(actor), std::chrono::steady_clock::now()));
+            EXPECT_TRUE(out.has_value() && *out != MoveOutcome::Invalid);
+            if (!out || *out == MoveOutcome::GameEnded || *out == MoveOutcome::Invalid) break;
+        }
+        return g.Capture();
+    };
+
+    for (uint64_t game = 0; game < 8; ++game)
+    {
+        EXPECT_EQ(play(game), play(game)) << "game " << game;
+    }
+    EXPECT_NE(play(0), play(1));
+}
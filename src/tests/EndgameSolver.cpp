@@ -0,0 +1,113 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include "../core/ClassicRules.hpp"
+#include "../core/CompactMove.hpp"
+#include "../core/EndgameSolver.hpp"
+#include "../core/Game.hpp"
+#include "../core/RandomAi.hpp"
+#include "../core/Util.hpp"
+
+using namespace durak::core;
+using namespace std::chrono_literals;
+
+namespace
+{
+    auto Uid(Suit const s, Rank const r) -> uint8_t { return static_cast<uint8_t>(util::CardToUID(Card{s, r})); }
+}
+
+TEST(EndgameSolver, Attacker_With_Last_Card_Wins)
+{
+    EndgamePosition p{};
+    p.trump = Suit::Hearts;
+    p.hands[0] = uint64_t{1} << Uid(Suit::Spades, Rank::Two);
+    p.hands[1] = (uint64_t{1} << Uid(Suit::Clubs, Rank::Ace)) | (uint64_t{1} << Uid(Suit::Hearts, Rank::Ace));
+
+    EndgameSolver solver;
+    auto const r = solver.Solve(p, std::chrono::steady_clock::now() + 1s);
+    ASSERT_TRUE(r.has_value());
+    EXPECT_TRUE(r->solved);
+    EXPECT_EQ(r->value, EndgameSolver::Win);
+    EXPECT_EQ(r->move.kind, 0);
+}
+
+// RandomAI plays until the deck is gone, then both seats follow the solver. Every solver move must be
+// legal, and a proven result must be what actually happens.
+TEST(EndgameSolver, Solver_Play_Matches_Proven_Value)
+{
+    EndgameSolver solver;
+    int solved_games = 0;
+    for (std::uint64_t seed = 1; seed <= 20; ++seed)
+    {
+        Config cfg{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = seed};
+        std::vector<std::unique_ptr<Player>> ps;
+        ps.emplace_back(std::make_unique<RandomAI>(seed));
+        ps.emplace_back(std::make_unique<RandomAI>(seed + 100));
+        GameImpl game(cfg, std::make_unique<ClassicRules>(), std::move(ps));
+
+        MoveOutcome out = MoveOutcome::Applied;
+        for (int step = 0; step < 2000 && out != MoveOutcome::GameEnded; ++step)
+        {
+            if (game.DeckSize() == 0 && EndgamePosition::From(game.Capture())) break;
+            out = game.Step();
+        }
+        if (out == MoveOutcome::GameEnded) continue;
+
+        auto const root = EndgamePosition::From(game.Capture());
+        ASSERT_TRUE(root.has_value());
+        PlyrIdxT const first = root->ToMove();
+        auto const r0 = solver.Solve(*root, std::chrono::steady_clock::now() + 500ms);
+        ASSERT_TRUE(r0.has_value());
+        if (!r0->solved) continue;
+        ++solved_games;
+
+        for (int ply = 0; ply < 500 && out != MoveOutcome::GameEnded; ++ply)
+        {
+            auto const pos = EndgamePosition::From(game.Capture());
+            ASSERT_TRUE(pos.has_value());
+            auto const r = solver.Solve(*pos, std::chrono::steady_clock::now() + 500ms);
+            ASSERT_TRUE(r.has_value());
+            auto const res = game.TryResolve(ToAction(game, game.CurrentActor(), r->move));
+            ASSERT_TRUE(res.has_value());
+            out = *res;
+            ASSERT_NE(out, MoveOutcome::Invalid) << "seed " << seed << " ply " << ply;
+        }
+        ASSERT_EQ(out, MoveOutcome::GameEnded);
+
+        size_t const mine = game.HandSize(first);
+        size_t const theirs = game.HandSize(1 - first);
+        if (r0->value == EndgameSolver::Win) EXPECT_TRUE(mine == 0 && theirs != 0) << "seed " << seed;
+        else if (r0->value == -EndgameSolver::Win) EXPECT_TRUE(mine != 0) << "seed " << seed;
+        else EXPECT_TRUE(mine == 0 && theirs == 0) << "seed " << seed;
+    }
+    EXPECT_GT(solved_games, 0);
+}
+
+TEST(EndgameSolver, Respects_Deadline)
+{
+    // Full 36-card deck split between the seats: far too big to solve in a few milliseconds
+    EndgamePosition p{};
+    p.trump = Suit::Diamonds;
+    bool to_first = true;
+    for (uint8_t s = 0; s < 4; ++s)
+    {
+        for (uint8_t r = std::to_underlying(Rank::Six); r <= std::to_underlying(Rank::Ace); ++r)
+        {
+            p.hands[to_first ? 0 : 1] |= uint64_t{1} << Uid(static_cast<Suit>(s), static_cast<Rank>(r));
+            to_first = !to_first;
+        }
+    }
+
+    EndgameSolver solver;
+    auto const start = std::chrono::steady_clock::now();
+    auto const r = solver.Solve(p, start + 30ms);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 500ms);
+    if (r)
+    {
+        EXPECT_GE(r->depth, 1);
+    }
+}
@@ -0,0 +1,89 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "../core/ClassicRules.hpp"
+#include "../core/Exception.hpp"
+#include "../core/Game.hpp"
+#include "../core/Util.hpp"
+
+using namespace durak::core;
+
+namespace
+{
+    auto Fails(int const n) -> error::Result<int>
+    {
+        if (n < 0) DRK_FAIL(error::Code::State, "negative");
+        return n;
+    }
+
+    auto Forwards(int const n) -> error::Result<int>
+    {
+        DRK_TRY(Fails(n));
+        return n + 1;
+    }
+}
+
+// Attacker plays their last card, defender covers with their last card, deck empty: nobody is the fool.
+TEST(Engine, Drawn_Finish_Ends_The_Game)
+{
+    GameImpl game(Config{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = 3}, std::make_unique<ClassicRules>());
+    StateImage img{};
+    img.hands = {{4}, {5}}; // 6H | 7H
+    img.table_atk.fill(StateImage::NoCard);
+    img.table_def.fill(StateImage::NoCard);
+    img.trump = Suit::Spades;
+    game.Restore(img);
+
+    auto const atk = game.TryResolve(AttackAction{{game.FindFromHand(0, Card{Suit::Hearts, Rank::Six})}});
+    ASSERT_TRUE(atk.has_value());
+    ASSERT_EQ(*atk, MoveOutcome::Applied);
+
+    auto const def = game.TryResolve(DefendAction{{DefendPair{game.FindFromAtkTable(Card{Suit::Hearts, Rank::Six}),
+                                                              game.FindFromHand(1, Card{Suit::Hearts, Rank::Seven})}}});
+    ASSERT_TRUE(def.has_value());
+    ASSERT_EQ(*def, MoveOutcome::Applied);
+
+    // The empty-handed attacker still closes the bout; with nobody holding cards that ends the game
+    ASSERT_EQ(game.CurrentActor(), 0);
+    auto const pass = game.TryResolve(PassAction{});
+    ASSERT_TRUE(pass.has_value()) << pass.error().msg;
+    EXPECT_EQ(*pass, MoveOutcome::GameEnded);
+    EXPECT_EQ(game.HandSize(0), 0u);
+    EXPECT_EQ(game.HandSize(1), 0u);
+    EXPECT_EQ(game.DiscardSize(), 2u);
+}
+
+// Engine failures come back as values with their origin; the classic entry points raise them.
+TEST(Engine, Engine_Errors_Are_Results)
+{
+    auto const direct = Fails(-1);
+    ASSERT_FALSE(direct.has_value());
+    auto const forwarded = Forwards(-1);
+    ASSERT_FALSE(forwarded.has_value());
+    EXPECT_EQ(forwarded.error().code, error::Code::State);
+    EXPECT_EQ(forwarded.error().msg, "negative");
+    EXPECT_EQ(forwarded.error().where.line(), direct.error().where.line()); // DRK_TRY keeps the origin
+    EXPECT_EQ(Forwards(1), 2);
+
+    GameImpl game(Config{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = 3}, std::make_unique<ClassicRules>());
+    StateImage const before = game.Capture();
+
+    auto const step = game.TryStep(); // no players attached
+    ASSERT_FALSE(step.has_value());
+    EXPECT_EQ(step.error().code, error::Code::Assertion);
+
+    uint8_t const id = before.hands[1][0];
+    CardWP const theirs = game.FindFromHand(1, Card{util::UIDToSuit(id), util::UIDToRank(id)});
+    auto const moved = game.MoveHandToTable(0, theirs);
+    ASSERT_FALSE(moved.has_value());
+    EXPECT_EQ(moved.error().msg, "Attacker card not in hand");
+    EXPECT_EQ(game.Capture(), before);
+
+#if DRK_ALLOW_EXCEPTIONS
+    EXPECT_THROW(game.Step(), error::AssertionError);
+#endif
+}
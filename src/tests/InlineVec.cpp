@@ -0,0 +1,56 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <span>
+
+#include "../core/Actions.hpp"
+#include "../core/InlineVec.hpp"
+
+using namespace durak::core;
+
+static_assert(std::ranges::contiguous_range<InlineVec<CardWP, 6>>);
+
+// Only live elements are constructed, and copies, moves and removal release what they own.
+TEST(InlineVec, Element_Lifetimes)
+{
+    auto const card = std::make_shared<int>(7);
+    {
+        InlineVec<std::shared_ptr<int>, 4> v{card, card};
+        EXPECT_EQ(card.use_count(), 3);
+
+        InlineVec<std::shared_ptr<int>, 4> copy = v;
+        EXPECT_EQ(card.use_count(), 5);
+
+        InlineVec<std::shared_ptr<int>, 4> moved = std::move(copy);
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(moved.size(), 2u);
+        EXPECT_EQ(card.use_count(), 5);
+
+        moved.pop_back();
+        EXPECT_EQ(card.use_count(), 4);
+        v = moved;
+        EXPECT_EQ(v.size(), 1u);
+        EXPECT_EQ(card.use_count(), 3);
+    }
+    EXPECT_EQ(card.use_count(), 1);
+}
+
+TEST(InlineVec, Actions_Stay_Inline)
+{
+    auto const a = std::make_shared<Card>(Suit::Hearts, Rank::Six);
+    auto const b = std::make_shared<Card>(Suit::Hearts, Rank::Ace);
+
+    AttackAction atk{{a, b}};
+    ASSERT_EQ(atk.cards.size(), 2u);
+    EXPECT_EQ(atk.cards.capacity(), constants::MaxTableSlots);
+    EXPECT_EQ(std::span{atk.cards}.back().lock(), b);
+
+    PlayerAction const action = DefendAction{{DefendPair{a, b}}};
+    DefendAction const& def = std::get<DefendAction>(action);
+    ASSERT_EQ(def.pairs.size(), 1u);
+    EXPECT_EQ(def.pairs.front().attack.lock(), a);
+    EXPECT_EQ(def.pairs.front().defend.lock(), b);
+}
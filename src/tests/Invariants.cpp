@@ -0,0 +1,159 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "../core/ClassicRules.hpp"
+#include "../core/Game.hpp"
+#include "../core/RandomAi.hpp"
+#include "../debug/Inspector.hpp"
+#include "../debug/Invariants.hpp"
+
+using namespace durak::core;
+using namespace durak::core::debug;
+
+namespace
+{
+    Config const Cfg{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = 5};
+
+    // A freshly dealt heads-up game: seat 0 attacks seat 1, nothing on the table.
+    auto Dealt() -> StateImage { return GameImpl(Cfg, std::make_unique<ClassicRules>()).Capture(); }
+
+    auto FaultOf(StateImage const& img) -> InvariantFault
+    {
+        GameImpl g(Cfg, std::make_unique<ClassicRules>());
+        g.Restore(img);
+        return CheckInvariantsFast(g);
+    }
+
+    // Moves seat's hand card i onto the table as the attack in 'slot'.
+    auto Attack(StateImage& img, PlyrIdxT const seat, size_t const i, size_t const slot) -> void
+    {
+        img.table_atk[slot] = img.hands[seat][i];
+        img.hands[seat].erase(img.hands[seat].begin() + static_cast<std::ptrdiff_t>(i));
+    }
+}
+
+TEST(Invariants, Dealt_Game_Is_Clean)
+{
+    EXPECT_EQ(FaultOf(Dealt()), InvariantFault::None);
+}
+
+TEST(Invariants, ZoneSizeMismatch)
+{
+    StateImage img = Dealt();
+    img.hands[0][1] = img.hands[0][0]; // the card twice in one hand, its neighbour lost
+    EXPECT_EQ(FaultOf(img), InvariantFault::ZoneSizeMismatch);
+}
+
+TEST(Invariants, CardsOverlap)
+{
+    StateImage img = Dealt();
+    img.hands[0].push_back(img.hands[1][0]);
+    EXPECT_EQ(FaultOf(img), InvariantFault::CardsOverlap);
+}
+
+TEST(Invariants, CardsMissing)
+{
+    StateImage img = Dealt();
+    img.deck.pop_back();
+    EXPECT_EQ(FaultOf(img), InvariantFault::CardsMissing);
+}
+
+TEST(Invariants, DefendWithoutAttack)
+{
+    StateImage img = Dealt();
+    img.table_def[0] = img.hands[1].back();
+    img.hands[1].pop_back();
+    EXPECT_EQ(FaultOf(img), InvariantFault::DefendWithoutAttack);
+}
+
+TEST(Invariants, TableRanksStale)
+{
+    GameImpl g(Cfg, std::make_unique<ClassicRules>());
+    Inspector::MasksOf(g).table_ranks ^= 1;
+    EXPECT_EQ(CheckInvariantsFast(g), InvariantFault::TableRanksStale);
+}
+
+TEST(Invariants, AttackCapExceeded)
+{
+    StateImage img = Dealt();
+    Attack(img, 0, 0, 0);
+    Attack(img, 0, 0, 1);
+    img.phase = Phase::Defending;
+    img.bout_cap = 1;
+    EXPECT_EQ(FaultOf(img), InvariantFault::AttackCapExceeded);
+
+    img.bout_cap = constants::MaxTableSlots + 1;
+    EXPECT_EQ(FaultOf(img), InvariantFault::AttackCapExceeded);
+}
+
+TEST(Invariants, BadRoles)
+{
+    StateImage img = Dealt();
+    img.defender_idx = img.attacker_idx;
+    EXPECT_EQ(FaultOf(img), InvariantFault::BadRoles);
+
+    img.defender_idx = Cfg.n_players;
+    EXPECT_EQ(FaultOf(img), InvariantFault::BadRoles);
+}
+
+TEST(Invariants, UncoveredExceedsHand)
+{
+    StateImage img = Dealt();
+    Attack(img, 0, 0, 0);
+    Attack(img, 0, 0, 1);
+    img.discard.assign(img.hands[1].begin() + 1, img.hands[1].end()); // the defender keeps one card
+    img.hands[1].resize(1);
+    img.phase = Phase::Defending;
+    EXPECT_EQ(FaultOf(img), InvariantFault::UncoveredExceedsHand);
+}
+
+TEST(Invariants, DefendingWithoutUncovered)
+{
+    StateImage img = Dealt();
+    img.phase = Phase::Defending;
+    EXPECT_EQ(FaultOf(img), InvariantFault::DefendingWithoutUncovered);
+}
+
+TEST(Invariants, AttackingWithUncovered)
+{
+    StateImage img = Dealt();
+    Attack(img, 0, 0, 0);
+    EXPECT_EQ(FaultOf(img), InvariantFault::AttackingWithUncovered);
+}
+
+// A sampler with period N checks on every Nth step only, and a clean game never counts a fault.
+TEST(Invariants, Sampler_Checks_Every_Nth_Step)
+{
+    for (uint32_t const every : {1u, 3u, 7u})
+    {
+        std::vector<std::unique_ptr<Player>> ps;
+        ps.emplace_back(std::make_unique<RandomAI>(11));
+        ps.emplace_back(std::make_unique<RandomAI>(12));
+        GameImpl game(Cfg, std::make_unique<ClassicRules>(), std::move(ps));
+
+        InvariantSampler sampler(every);
+        uint64_t steps = 0;
+        for (MoveOutcome out = MoveOutcome::Applied; out != MoveOutcome::GameEnded; ++steps)
+        {
+            out = game.Step();
+            EXPECT_EQ(sampler.OnStep(game), InvariantFault::None);
+        }
+        ASSERT_GT(steps, every);
+        EXPECT_EQ(sampler.Checks(), steps / every) << "every " << every;
+        EXPECT_EQ(sampler.Faults(), 0u);
+    }
+}
+
+// Period 0 would never fire; it is treated as checking every step.
+TEST(Invariants, Sampler_Period_Zero_Checks_Every_Step)
+{
+    GameImpl game(Cfg, std::make_unique<ClassicRules>());
+    InvariantSampler sampler(0);
+    for (int i = 0; i < 5; ++i) sampler.OnStep(game);
+    EXPECT_EQ(sampler.Checks(), 5u);
+}
@@ -0,0 +1,67 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <variant>
+
+#include "../core/Game.hpp"
+#include "../core/ClassicRules.hpp"
+#include "../core/IsmctsAi.hpp"
+#include "../core/RandomAi.hpp"
+
+using namespace durak::core;
+
+TEST(IsmctsAi, Beats_Random_Heads_Up)
+{
+    constexpr int Games = 10;
+    int losses = 0;
+
+    for (int g = 0; g < Games; ++g)
+    {
+        Config cfg{
+            .n_players = 2,
+            .deal_up_to = 6,
+            .deck36 = true,
+            .seed = 9000ull + g,
+            .turn_timeout = std::chrono::seconds(10u)
+        };
+
+        // Alternate seats so the first attack isn't always ours
+        PlyrIdxT const bot_seat = static_cast<PlyrIdxT>(g % 2);
+        std::vector<std::unique_ptr<Player>> ps(2);
+        ps[bot_seat] = std::make_unique<IsmctsAI>(g, IsmctsConfig{.threads = 2, .max_iterations = 300});
+        ps[1 - bot_seat] = std::make_unique<RandomAI>(g + 100u);
+        GameImpl game(cfg, std::make_unique<ClassicRules>(), std::move(ps));
+
+        MoveOutcome out = MoveOutcome::Applied;
+        for (int step = 0; step < 2000 && out != MoveOutcome::GameEnded; ++step)
+        {
+            out = game.Step();
+            ASSERT_NE(out, MoveOutcome::Invalid) << "seat " << static_cast<int>(game.LastActor())
+                                                 << " made an illegal move in game " << g;
+        }
+        ASSERT_EQ(out, MoveOutcome::GameEnded);
+        losses += game.HandSize(bot_seat) != 0;
+    }
+
+    EXPECT_LE(losses, 3) << "ISMCTS lost " << losses << " of " << Games << " to RandomAI";
+}
+
+TEST(IsmctsAi, Stops_At_Deadline)
+{
+    Config cfg{.n_players = 3, .deal_up_to = 6, .deck36 = true, .seed = 31ull};
+    GameImpl game(cfg, std::make_unique<ClassicRules>());
+
+    IsmctsAI bot(5u, IsmctsConfig{.threads = 4});
+    auto const budget = std::chrono::milliseconds(80);
+    auto const t0 = std::chrono::steady_clock::now();
+    PlayerAction const act = bot.Play(game.SnapshotFor(game.CurrentActor()), t0 + budget);
+    auto const took = std::chrono::steady_clock::now() - t0;
+
+    EXPECT_LT(took, budget + std::chrono::milliseconds(40));
+    EXPECT_GT(took, budget / 2); // anytime: the budget is actually used
+    EXPECT_GT(bot.LastIterations(), 0u);
+    EXPECT_TRUE(std::holds_alternative<AttackAction>(act));
+    EXPECT_NE(game.Resolve(act), MoveOutcome::Invalid);
+}
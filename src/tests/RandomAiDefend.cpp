@@ -0,0 +1,139 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <variant>
+#include <vector>
+
+#include "../core/ClassicRules.hpp"
+#include "../core/RandomAi.hpp"
+
+using namespace durak::core;
+
+namespace
+{
+    // Card is move-only, so positions are described by (suit, rank) pairs.
+    using Spec = std::pair<Suit, Rank>;
+
+    // Owns the cards a defending snapshot points at.
+    struct DefendSpot
+    {
+        std::vector<CardSP> owners;
+        GameSnapshot snap{};
+
+        DefendSpot(Suit trump, std::vector<Spec> const& attacks, std::vector<Spec> const& hand)
+        {
+            snap.trump = trump;
+            snap.n_players = 2;
+            snap.attacker_idx = 0;
+            snap.defender_idx = 1;
+            snap.phase = Phase::Defending;
+            snap.other_counts = {6, static_cast<uint8_t>(hand.size())};
+            for (size_t i = 0; i < attacks.size(); ++i)
+            {
+                snap.table[i].attack = owners.emplace_back(std::make_shared<Card>(attacks[i].first, attacks[i].second));
+            }
+            for (auto const& [suit, rank] : hand)
+            {
+                snap.my_hand.push_back(owners.emplace_back(std::make_shared<Card>(suit, rank)));
+            }
+        }
+
+        auto Play(RandomAI& ai) const -> PlayerAction
+        {
+            return ai.Play(std::make_shared<GameSnapshot const>(snap), std::chrono::steady_clock::now());
+        }
+
+        // Returns the (attack, defend) pairs after checking they form a legal full cover.
+        auto CheckCover(PlayerAction const& act) const -> std::vector<std::pair<Spec, Spec>>
+        {
+            std::vector<std::pair<Spec, Spec>> out;
+            auto const* d = std::get_if<DefendAction>(&act);
+            EXPECT_NE(d, nullptr);
+            if (!d) return out;
+
+            std::set<CardSP> used_atk, used_def;
+            for (DefendPair const& p : d->pairs)
+            {
+                CardSP const a = p.attack.lock();
+                CardSP const c = p.defend.lock();
+                EXPECT_TRUE(a && c);
+                EXPECT_TRUE(ClassicRules::Beats(*c, *a, snap.trump));
+                used_atk.insert(a);
+                used_def.insert(c);
+                out.emplace_back(Spec{a->suit, a->rank}, Spec{c->suit, c->rank});
+            }
+            size_t attacks{};
+            for (TableSlotView const& ts : snap.table) attacks += !ts.attack.expired();
+            EXPECT_EQ(used_atk.size(), attacks);
+            EXPECT_EQ(used_def.size(), d->pairs.size());
+            return out;
+        }
+    };
+} // anonymous namespace
+
+TEST(RandomAiDefend, Thirty_Card_Hand_Covers_Six)
+{
+    // Whole 36-card deck split into six low attacks and a 30-card defender hand
+    std::vector<Spec> attacks{
+        {Suit::Hearts, Rank::Six}, {Suit::Hearts, Rank::Seven}, {Suit::Diamonds, Rank::Six},
+        {Suit::Diamonds, Rank::Seven}, {Suit::Clubs, Rank::Six}, {Suit::Clubs, Rank::Seven}
+    };
+    std::vector<Spec> hand;
+    for (Suit s : {Suit::Hearts, Suit::Diamonds, Suit::Clubs, Suit::Spades})
+    {
+        for (uint8_t r = std::to_underlying(Rank::Six); r <= std::to_underlying(Rank::Ace); ++r)
+        {
+            Spec const c{s, static_cast<Rank>(r)};
+            if (std::ranges::find(attacks, c) == attacks.end()) hand.push_back(c);
+        }
+    }
+    ASSERT_EQ(hand.size(), 30u);
+
+    DefendSpot const spot(Suit::Spades, attacks, hand);
+    RandomAI ai(99u);
+    for (int i = 0; i < 500; ++i)
+    {
+        EXPECT_EQ(spot.CheckCover(spot.Play(ai)).size(), attacks.size());
+    }
+}
+
+TEST(RandomAiDefend, Samples_Covers_Uniformly)
+{
+    // 6H and 10H vs {7H, JH, QH}: 7H only beats 6H, so exactly four full covers exist
+    DefendSpot const spot(Suit::Spades,
+                          {{Suit::Hearts, Rank::Six}, {Suit::Hearts, Rank::Ten}},
+                          {{Suit::Hearts, Rank::Seven}, {Suit::Hearts, Rank::Jack}, {Suit::Hearts, Rank::Queen}});
+    RandomAI ai(7u);
+
+    std::map<std::vector<uint8_t>, int> seen;
+    constexpr int N = 8000;
+    for (int i = 0; i < N; ++i)
+    {
+        auto pairs = spot.CheckCover(spot.Play(ai));
+        std::ranges::sort(pairs, {}, [](auto const& p) { return std::to_underlying(p.first.second); });
+        std::vector<uint8_t> key;
+        for (auto const& [a, d] : pairs) key.push_back(std::to_underlying(d.second));
+        ++seen[key];
+    }
+
+    ASSERT_EQ(seen.size(), 4u);
+    for (auto const& [key, n] : seen)
+    {
+        EXPECT_NEAR(n, N / 4, N / 20);
+    }
+}
+
+TEST(RandomAiDefend, Takes_When_No_Cover)
+{
+    // Two hearts can't both be covered by a single higher heart
+    DefendSpot const spot(Suit::Spades,
+                          {{Suit::Hearts, Rank::Six}, {Suit::Hearts, Rank::Seven}},
+                          {{Suit::Hearts, Rank::Ace}, {Suit::Clubs, Rank::Six}});
+    RandomAI ai(1u);
+    EXPECT_TRUE(std::holds_alternative<TakeAction>(spot.Play(ai)));
+}
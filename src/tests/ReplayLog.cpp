@@ -0,0 +1,147 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <format>
+#include <vector>
+
+#include "../core/Game.hpp"
+#include "../core/ClassicRules.hpp"
+#include "../core/RandomAi.hpp"
+#include "../debug/ReplayEngine.hpp"
+#include "../debug/ReplayLog.hpp"
+
+using namespace durak::core;
+
+namespace
+{
+    auto make_game(std::uint64_t seed) -> GameImpl
+    {
+        Config cfg{
+            .n_players = 2,
+            .deal_up_to = 6,
+            .deck36 = true,
+            .seed = seed,
+            .turn_timeout = std::chrono::seconds(2u)
+        };
+
+        std::vector<std::unique_ptr<Player>> ps;
+        ps.emplace_back(std::make_unique<RandomAI>(seed + 1));
+        ps.emplace_back(std::make_unique<RandomAI>(seed + 2));
+        return GameImpl(cfg, std::make_unique<ClassicRules>(), std::move(ps));
+    }
+} // anonymous namespace
+
+TEST(ReplayLog, RoundTrip_Appended_Games)
+{
+    namespace fs = std::filesystem;
+    fs::create_directories("_artifacts");
+    std::string const path = "_artifacts/replay_roundtrip.drkr";
+    fs::remove(path);
+
+    std::vector<std::uint64_t> const seeds{111ull, 222ull, 333ull};
+    std::vector<std::vector<std::pair<PlyrIdxT, std::size_t>>> expected;
+
+    {
+        debug::ReplayWriter w(path);
+        std::array const kinds{debug::ReplayPlayerKind::Random, debug::ReplayPlayerKind::Random};
+
+        for (std::uint64_t const seed : seeds)
+        {
+            auto game = make_game(seed);
+            w.Begin(game.Cfg(), debug::ReplayRules::Classic, kinds);
+
+            auto& steps = expected.emplace_back();
+            MoveOutcome out = MoveOutcome::Applied;
+            while (out != MoveOutcome::GameEnded)
+            {
+                out = game.Step();
+                w.Record(game, out);
+                steps.emplace_back(game.LastActor(), game.LastAction().index());
+            }
+            w.End(game);
+        }
+    }
+
+    // Storage budget: the whole point is a few hundred bytes per game
+    EXPECT_LT(fs::file_size(path), seeds.size() * 1024u);
+
+    auto reader = debug::ReplayReader::Open(path);
+    ASSERT_TRUE(reader.has_value()) << reader.error().message;
+
+    for (std::size_t g = 0; g < seeds.size(); ++g)
+    {
+        auto next = reader->NextGame();
+        ASSERT_TRUE(next.has_value()) << next.error().message << " @" << next.error().offset;
+        ASSERT_TRUE(next->has_value());
+
+        debug::ReplayGame const& game = **next;
+        EXPECT_TRUE(game.complete);
+        EXPECT_EQ(game.header.config.seed, seeds[g]);
+        EXPECT_EQ(game.header.config.n_players, 2u);
+        EXPECT_TRUE(game.header.config.deck36);
+        ASSERT_EQ(game.records.size(), expected[g].size());
+        for (std::size_t i = 0; i < game.records.size(); ++i)
+        {
+            EXPECT_EQ(game.records[i].actor, expected[g][i].first);
+            EXPECT_EQ(game.records[i].kind, expected[g][i].second);
+        }
+        EXPECT_EQ(game.records.back().outcome, MoveOutcome::GameEnded);
+    }
+
+    auto tail = reader->NextGame();
+    ASSERT_TRUE(tail.has_value());
+    EXPECT_FALSE(tail->has_value());
+}
+
+TEST(ReplayEngine, Seek_Matches_Live_States)
+{
+    namespace fs = std::filesystem;
+    fs::create_directories("_artifacts");
+    std::string const path = "_artifacts/replay_seek.drkr";
+    fs::remove(path);
+
+    // Live run: remember the full state after every step
+    std::vector<StateImage> live;
+    {
+        auto game = make_game(4242ull);
+        live.push_back(game.Capture());
+
+        debug::ReplayWriter w(path);
+        std::array const kinds{debug::ReplayPlayerKind::Random, debug::ReplayPlayerKind::Random};
+        w.Begin(game.Cfg(), debug::ReplayRules::Classic, kinds);
+
+        MoveOutcome out = MoveOutcome::Applied;
+        while (out != MoveOutcome::GameEnded)
+        {
+            out = game.Step();
+            w.Record(game, out);
+            live.push_back(game.Capture());
+        }
+        w.End(game);
+    }
+
+    auto reader = debug::ReplayReader::Open(path);
+    ASSERT_TRUE(reader.has_value()) << reader.error().message;
+    auto rec = reader->NextGame();
+    ASSERT_TRUE(rec.has_value() && rec->has_value());
+
+    auto eng = debug::ReplayEngine::Create(std::move(**rec), 8);
+    ASSERT_TRUE(eng.has_value()) << eng.error().message;
+    ASSERT_EQ(eng->StepCount() + 1, live.size());
+
+    auto const verified = eng->Verify();
+    ASSERT_TRUE(verified.has_value()) << verified.error().message;
+
+    // Backwards, forwards and scattered seeks all land on the live state
+    for (std::size_t n : {live.size() - 1, std::size_t{0}, std::size_t{7}, std::size_t{8}, std::size_t{9},
+                          live.size() / 2, std::size_t{3}, live.size() - 2})
+    {
+        n = std::min(n, live.size() - 1);
+        ASSERT_TRUE(eng->SeekTo(n).has_value());
+        EXPECT_EQ(eng->Position(), n);
+        EXPECT_EQ(eng->State().Capture(), live[n]) << "state mismatch at step " << n;
+    }
+}
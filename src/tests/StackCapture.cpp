@@ -0,0 +1,85 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string>
+#include <vector>
+
+#include "../core/Exception.hpp"
+
+using namespace durak::core;
+
+namespace
+{
+    int g_frames = 0; // keeps the recursion from becoming a loop
+
+    auto CaptureAt(int const depth, StackCapture const mode) -> OmegaException<int>
+    {
+        if (depth == 0) return OmegaException<int>("deep", 0, std::source_location::current(), mode);
+        OmegaException<int> e = CaptureAt(depth - 1, mode);
+        ++g_frames;
+        return e;
+    }
+
+    auto FrameLines(OmegaException<int> const& e) -> std::size_t
+    {
+        std::string const s = e.to_str();
+        return static_cast<std::size_t>(std::ranges::count(s, '\n')) - 1; // first line is the source location
+    }
+}
+
+TEST(StackCapture, Off_Records_Nothing)
+{
+    OmegaException<int> const e("off", 0, std::source_location::current(), StackCapture::Off);
+    EXPECT_TRUE(e.stack().empty());
+    EXPECT_EQ(FrameLines(e), 0u);
+}
+
+// A capture cut at LazyStackDepth never reached main, so none of its frames are the runtime's.
+TEST(StackCapture, Lazy_Keeps_Every_Frame_Of_A_Cut_Capture)
+{
+    OmegaException<int> const e = CaptureAt(40, StackCapture::Lazy);
+    ASSERT_EQ(e.stack().size(), LazyStackDepth);
+    EXPECT_EQ(FrameLines(e), LazyStackDepth);
+}
+
+// A whole stack ends in the start/main wrappers, which are dropped.
+TEST(StackCapture, Full_Drops_The_Runtime_Frames)
+{
+    OmegaException<int> const e = CaptureAt(40, StackCapture::Full);
+    ASSERT_GT(e.stack().size(), 40u);
+    EXPECT_EQ(FrameLines(e), e.stack().size() - 3);
+}
+
+// Past the burst, fail() still throws but skips the capture and counts it.
+TEST(StackCapture, Limiter_Suppresses_Past_The_Burst)
+{
+    StackCapture const mode = GetStackCapture();
+    SetStackCapture(StackCapture::Lazy);
+    error::SetStackCaptureRate(1, 3);
+    std::uint64_t const suppressed = error::Limiter().Suppressed(error::Code::Timeout);
+
+    std::vector<bool> captured;
+    for (int i = 0; i < 10; ++i)
+    {
+        try
+        {
+            error::fail(error::Code::Timeout, "storm");
+        }
+        catch (error::TimeoutError const& e)
+        {
+            captured.push_back(!e.stack().empty());
+        }
+    }
+
+    EXPECT_EQ(captured, (std::vector<bool>{true, true, true, false, false, false, false, false, false, false}));
+    EXPECT_EQ(error::Limiter().Suppressed(error::Code::Timeout) - suppressed, 7u);
+
+    error::SetStackCaptureRate(20, 20);
+    SetStackCapture(mode);
+}
@@ -0,0 +1,193 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../core/ClassicRules.hpp"
+#include "../core/RandomAi.hpp"
+#include "../core/TableHost.hpp"
+#include "../core/TimerWheel.hpp"
+
+using namespace durak::core;
+using namespace std::chrono_literals;
+
+namespace
+{
+    TimerWheel::Clock::time_point const T0{};
+}
+
+// Timers fire in deadline order, never early, across every level of the wheel.
+TEST(TimerWheel, Fires_In_Order_Across_Levels)
+{
+    TimerWheel wheel(T0);
+    std::mt19937_64 rng{11};
+    std::vector<int64_t> due;
+    std::vector<int64_t> fired;
+    for (int i = 0; i < 4000; ++i)
+    {
+        // Mostly near deadlines, some hours out to exercise the cascades
+        uint64_t const span = (i % 10 == 0) ? 20'000'000 : 5000;
+        auto const ms = static_cast<int64_t>(rng() % span);
+        due.push_back(ms);
+        wheel.Schedule(T0 + std::chrono::milliseconds(ms), [&fired, ms] { fired.push_back(ms); });
+    }
+    EXPECT_EQ(wheel.Pending(), due.size());
+
+    int64_t now = 0;
+    size_t total = 0;
+    while (wheel.Pending() != 0)
+    {
+        now += 1 + static_cast<int64_t>(rng() % 200'000);
+        size_t const before = fired.size();
+        total += wheel.Advance(T0 + std::chrono::milliseconds(now));
+        for (size_t i = before; i < fired.size(); ++i) ASSERT_LE(fired[i], now);
+    }
+    EXPECT_EQ(total, due.size());
+    EXPECT_TRUE(std::ranges::is_sorted(fired));
+    std::ranges::sort(due);
+    EXPECT_EQ(fired, due);
+}
+
+TEST(TimerWheel, Fires_On_The_Due_Tick)
+{
+    TimerWheel wheel(T0);
+    int fired = 0;
+    wheel.Schedule(T0 + 4096ms, [&] { ++fired; });
+    EXPECT_EQ(wheel.Advance(T0 + 4095ms), 0u);
+    EXPECT_EQ(wheel.Advance(T0 + 4096ms), 1u);
+    EXPECT_EQ(fired, 1);
+
+    // Already past: next tick
+    wheel.Schedule(T0, [&] { ++fired; });
+    EXPECT_EQ(wheel.Advance(T0 + 4097ms), 1u);
+    EXPECT_EQ(fired, 2);
+}
+
+TEST(TimerWheel, Cancel_And_Reuse)
+{
+    TimerWheel wheel(T0);
+    int fired = 0;
+    auto const a = wheel.Schedule(T0 + 10ms, [&] { fired += 1; });
+    auto const b = wheel.Schedule(T0 + 70'000ms, [&] { fired += 10; });
+    EXPECT_TRUE(wheel.Cancel(a));
+    EXPECT_FALSE(wheel.Cancel(a));
+
+    // The slot is reused; the stale id must not cancel the new timer
+    auto const c = wheel.Schedule(T0 + 20ms, [&] { fired += 100; });
+    EXPECT_EQ(c.node, a.node);
+    EXPECT_FALSE(wheel.Cancel(a));
+    EXPECT_EQ(wheel.Pending(), 2u);
+
+    EXPECT_EQ(wheel.Advance(T0 + 1000ms), 1u);
+    EXPECT_FALSE(wheel.Cancel(c));
+    EXPECT_TRUE(wheel.Cancel(b));
+    EXPECT_EQ(wheel.Advance(T0 + 100'000ms), 0u);
+    EXPECT_EQ(fired, 100);
+    EXPECT_EQ(wheel.Pending(), 0u);
+}
+
+// A callback scheduling the next timer (the host arming the next decision) fires once per period.
+TEST(TimerWheel, Callbacks_May_Reschedule)
+{
+    TimerWheel wheel(T0, 10ms);
+    int fired = 0;
+    std::function<void()> again = [&]
+    {
+        if (++fired < 5) wheel.Schedule(T0 + std::chrono::milliseconds(100 * (fired + 1)), again);
+    };
+    wheel.Schedule(T0 + 100ms, again);
+    EXPECT_EQ(wheel.Advance(T0 + 10s), 5u);
+    EXPECT_EQ(fired, 5);
+}
+
+// With nobody answering, every decision times out and the defaults play the game to the end
+// (heads-up: the defender always takes, so the attacker sheds its hand).
+TEST(TableHost, Timeouts_Finish_The_Game)
+{
+    TimerWheel wheel(T0);
+    Config const cfg{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = 5, .turn_timeout = 100ms};
+    size_t steps = 0;
+    size_t decisions = 0;
+    TableHost host(cfg, std::make_unique<ClassicRules>(), wheel,
+                   {.on_step = [&](MoveOutcome const out) { ++steps; EXPECT_NE(out, MoveOutcome::Invalid); },
+                    .on_violation = {},
+                    .on_decision = [&](PlyrIdxT, TimerWheel::Clock::time_point) { ++decisions; },
+                    .on_violation_summary = {}});
+    host.Start(T0);
+
+    for (auto now = T0; !host.Finished(); now += 50ms)
+    {
+        ASSERT_LT(now, T0 + 3600s);
+        wheel.Advance(now);
+    }
+    EXPECT_EQ(host.Timeouts(), steps);
+    EXPECT_EQ(decisions, steps);
+    EXPECT_EQ(wheel.Pending(), 0u);
+}
+
+// Submitted actions cancel the deadline; out-of-turn and invalid ones go through the gate.
+TEST(TableHost, Submissions_Cancel_Deadlines)
+{
+    TimerWheel wheel(T0);
+    Config const cfg{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = 9, .turn_timeout = 1s};
+    size_t violations = 0;
+    TableHost host(cfg, std::make_unique<ClassicRules>(), wheel,
+                   {.on_step = {},
+                    .on_violation = [&](PlyrIdxT, error::RuleViolation const&) { ++violations; },
+                    .on_decision = {},
+                    .on_violation_summary = {}});
+    host.Start(T0);
+
+    PlyrIdxT const actor = host.Game().CurrentActor();
+    EXPECT_FALSE(host.Submit(static_cast<PlyrIdxT>(1 - actor), PassAction{}, T0));
+    EXPECT_TRUE(host.Submit(actor, TakeAction{}, T0)); // attacker may not take
+    EXPECT_EQ(violations, 1u);
+    EXPECT_EQ(wheel.Pending(), 1u);
+
+    RandomAI ai{3};
+    auto now = T0;
+    while (!host.Finished())
+    {
+        now += 10ms;
+        PlyrIdxT const seat = host.Game().CurrentActor();
+        ASSERT_TRUE(host.Submit(seat, ai.Play(host.Game().SnapshotFor(seat), now), now));
+        ASSERT_EQ(wheel.Advance(now), 0u);
+    }
+    EXPECT_EQ(host.Timeouts(), 0u);
+    EXPECT_EQ(wheel.Pending(), 0u);
+}
+
+// Invalid actions inside the retry budget keep the decision's original deadline.
+TEST(TableHost, Retries_Keep_The_Deadline)
+{
+    TimerWheel wheel(T0);
+    Config const cfg{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = 9, .turn_timeout = 1s};
+    std::vector<TimerWheel::Clock::time_point> deadlines;
+    size_t steps = 0;
+    TableHost host(cfg, std::make_unique<ClassicRules>(), wheel,
+                   {.on_step = [&](MoveOutcome) { ++steps; },
+                    .on_violation = {},
+                    .on_decision = [&](PlyrIdxT, TimerWheel::Clock::time_point const d) { deadlines.push_back(d); },
+                    .on_violation_summary = {}});
+    host.Start(T0);
+
+    PlyrIdxT const actor = host.Game().CurrentActor();
+    for (auto const at : {300ms, 600ms, 900ms}) // default gate budget is 3 retries
+    {
+        ASSERT_TRUE(host.Submit(actor, TakeAction{}, T0 + at)); // attacker may not take
+    }
+    EXPECT_EQ(steps, 0u);
+    EXPECT_EQ(deadlines, std::vector<TimerWheel::Clock::time_point>(4, T0 + 1s));
+
+    EXPECT_EQ(wheel.Advance(T0 + 999ms), 0u);
+    EXPECT_EQ(wheel.Advance(T0 + 1s), 1u);
+    EXPECT_EQ(host.Timeouts(), 1u);
+    EXPECT_EQ(steps, 1u);
+    EXPECT_EQ(deadlines.back(), T0 + 2s);
+}
@@ -0,0 +1,100 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../core/CounterRng.hpp"
+#include "../core/RandomAi.hpp"
+#include "../core/Tournament.hpp"
+
+using namespace durak::core;
+
+TEST(Tournament, Same_Results_For_Any_Thread_Count)
+{
+    std::vector<BotEntry> const bots{*MakeBot("random"), *MakeBot("ismcts:20"), *MakeBot("random")};
+    TournamentConfig cfg{.deals = 12, .threads = 1, .seed = 77};
+    TournamentReport const one = RunTournament(bots, cfg);
+    cfg.threads = 4;
+    TournamentReport const four = RunTournament(bots, cfg);
+
+    ASSERT_EQ(one.pairs.size(), 3u);
+    ASSERT_EQ(four.pairs.size(), 3u);
+    for (size_t i = 0; i < one.pairs.size(); ++i)
+    {
+        EXPECT_EQ(one.pairs[i].Games(), 2u * cfg.deals);
+        EXPECT_EQ(one.pairs[i].a_wins, four.pairs[i].a_wins);
+        EXPECT_EQ(one.pairs[i].b_wins, four.pairs[i].b_wins);
+        EXPECT_EQ(one.pairs[i].a_sweeps, four.pairs[i].a_sweeps);
+        EXPECT_EQ(one.pairs[i].b_sweeps, four.pairs[i].b_sweeps);
+    }
+    for (size_t i = 0; i < bots.size(); ++i)
+    {
+        EXPECT_EQ(one.bots[i].decisions, four.bots[i].decisions);
+        EXPECT_EQ(one.ratings[i].elo, four.ratings[i].elo);
+    }
+    EXPECT_EQ(one.engine_errors, 0u);
+}
+
+TEST(Tournament, Gauntlet_Only_Pairs_The_First_Bot)
+{
+    std::vector<BotEntry> const bots{*MakeBot("random"), *MakeBot("random"), *MakeBot("random")};
+    TournamentReport const rep = RunTournament(bots, {.format = TournamentFormat::Gauntlet, .deals = 2});
+    ASSERT_EQ(rep.pairs.size(), 2u);
+    EXPECT_EQ(rep.pairs[0].a, 0u);
+    EXPECT_EQ(rep.pairs[1].a, 0u);
+    EXPECT_FALSE(MakeBot("ismcts:zero").has_value());
+    EXPECT_FALSE(MakeBot("nobody").has_value());
+}
+
+// With counter_rng on, seat s of deal d gets its bot seed from stream s of (seed, d), in both seatings.
+TEST(Tournament, Counter_Rng_Seeds_Seats_By_Deal)
+{
+    std::vector<uint64_t> given;
+    BotFactory const record = [&](uint64_t const seed) -> std::unique_ptr<Player>
+    {
+        given.push_back(seed);
+        return std::make_unique<RandomAI>(seed);
+    };
+    std::vector<BotEntry> const bots{{"a", record}, {"b", record}};
+    TournamentConfig const cfg{.deals = 3, .threads = 1, .seed = 91, .counter_rng = true};
+    RunTournament(bots, cfg);
+
+    std::vector<uint64_t> expected;
+    for (uint64_t deal = 0; deal < cfg.deals; ++deal)
+    {
+        for (int swap = 0; swap < 2; ++swap)
+        {
+            for (uint64_t seat = 0; seat < 2; ++seat) expected.push_back(CounterRng::SeedFor(cfg.seed, deal, seat));
+        }
+    }
+    std::ranges::sort(given);
+    std::ranges::sort(expected);
+    EXPECT_EQ(given, expected);
+}
+
+TEST(Tournament, Bradley_Terry_Recovers_Known_Gap)
+{
+    // 75% against bots[0] is +190.8 Elo; bots[2] scores 50% against bots[1]
+    std::vector<PairStats> const pairs{
+        {.a = 0, .b = 1, .a_wins = 2500, .b_wins = 7500},
+        {.a = 1, .b = 2, .a_wins = 4000, .b_wins = 4000, .draws = 2000},
+        {.a = 0, .b = 2, .a_wins = 2500, .b_wins = 7500},
+    };
+    auto const r = FitBradleyTerry(3, pairs);
+    ASSERT_EQ(r.size(), 3u);
+    EXPECT_EQ(r[0].elo, 0.0);
+    EXPECT_NEAR(r[1].elo, 400.0 * std::log10(3.0), 1.0);
+    EXPECT_NEAR(r[2].elo, r[1].elo, 1.0);
+    EXPECT_GT(r[1].ci95, 0.0);
+    EXPECT_LT(r[1].ci95, 15.0);
+
+    // A perfect score stays finite
+    std::vector<PairStats> const sweep{{.a = 0, .b = 1, .a_wins = 0, .b_wins = 50}};
+    auto const s = FitBradleyTerry(2, sweep);
+    EXPECT_TRUE(std::isfinite(s[1].elo));
+    EXPECT_GT(s[1].elo, 400.0);
+}
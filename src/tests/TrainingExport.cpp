@@ -0,0 +1,118 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <map>
+
+#include "../core/Tournament.hpp"
+#include "../debug/TrainingExport.hpp"
+
+using namespace durak::core;
+using namespace durak::core::debug;
+
+namespace
+{
+    auto TempPath(char const* name) -> std::string
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    // Two workers writing small groups, so groups from both threads interleave in the file.
+    auto WriteSample(std::string const& path) -> TournamentReport
+    {
+        std::vector<BotEntry> const bots{*MakeBot("random"), *MakeBot("random")};
+        TrainingWriter writer(path);
+        TournamentConfig cfg{.deals = 20, .threads = 2, .seed = 5};
+        cfg.observer = [&writer](unsigned) -> std::unique_ptr<DuelObserver>
+        {
+            return std::make_unique<TrainingSink>(writer, 97);
+        };
+        TournamentReport rep = RunTournament(bots, cfg);
+        writer.Close();
+        return rep;
+    }
+}
+
+TEST(TrainingExport, Every_Decision_Round_Trips)
+{
+    std::string const path = TempPath("durak_training_rt.drkt");
+    TournamentReport const rep = WriteSample(path);
+
+    auto rd = TrainingReader::Open(path);
+    ASSERT_TRUE(rd.has_value()) << rd.error().message;
+    EXPECT_TRUE(rd->Indexed());
+    EXPECT_EQ(rd->TotalRows(), rep.bots[0].decisions + rep.bots[1].decisions);
+
+    std::map<std::uint64_t, std::map<std::uint8_t, std::int8_t>> results; // game -> seat -> result
+    for (std::size_t g = 0; g < rd->Groups(); ++g)
+    {
+        auto const hand = rd->Column<&TrainingRow::hand>(g);
+        auto const attack = rd->Column<&TrainingRow::legal_attack>(g);
+        auto const cover = rd->Column<&TrainingRow::legal_cover>(g);
+        auto const flags = rd->Column<&TrainingRow::legal_flags>(g);
+        auto const kind = rd->Column<&TrainingRow::kind>(g);
+        auto const cards = rd->Column<&TrainingRow::cards>(g);
+        auto const game = rd->Column<&TrainingRow::game>(g);
+        auto const seat = rd->Column<&TrainingRow::seat>(g);
+        auto const result = rd->Column<&TrainingRow::result>(g);
+        ASSERT_EQ(hand.size(), rd->Rows(g));
+
+        for (std::size_t i = 0; i < hand.size(); ++i)
+        {
+            EXPECT_EQ(attack[i] & ~hand[i], 0u);
+            EXPECT_EQ(cover[i] & ~hand[i], 0u);
+
+            // RandomAI only plays legal moves, so the chosen action must sit inside the legal sets
+            std::uint64_t played{};
+            if (kind[i] == 0) { played = std::uint64_t{1} << cards[i][0]; }
+            if (kind[i] == 1)
+            {
+                for (std::size_t k = 1; k < cards[i].size() && cards[i][k] != ReplayNoCard; k += 2)
+                {
+                    played |= std::uint64_t{1} << cards[i][k];
+                }
+            }
+            EXPECT_EQ(played & ~(kind[i] == 0 ? attack[i] : cover[i]), 0u);
+            if (kind[i] == 3) { EXPECT_TRUE(flags[i] & TrainingPassLegal); }
+            if (kind[i] == 4) { EXPECT_TRUE(flags[i] & TrainingTakeLegal); }
+
+            auto const it = results[game[i]].emplace(seat[i], result[i]).first;
+            EXPECT_EQ(it->second, result[i]); // one result per seat and game
+        }
+
+        TrainingRow const r = rd->Row(g, 0);
+        EXPECT_EQ(r.hand, hand[0]);
+        EXPECT_EQ(r.cards, cards[0]);
+    }
+
+    EXPECT_EQ(results.size(), 2u * 20u);
+    for (auto const& [id, seats] : results)
+    {
+        ASSERT_EQ(seats.size(), 2u);
+        int const sum = seats.at(0) + seats.at(1);
+        EXPECT_EQ(sum, 0) << "game " << id; // one winner and one loser, or a draw
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(TrainingExport, Unindexed_File_Still_Reads)
+{
+    std::string const path = TempPath("durak_training_cut.drkt");
+    WriteSample(path);
+    auto const full = TrainingReader::Open(path);
+    ASSERT_TRUE(full.has_value());
+
+    // Drop the index and half of the last group, as if the writer had been killed
+    auto const size = std::filesystem::file_size(path);
+    std::uint64_t const index_bytes = full->Groups() * 16 + 24;
+    std::filesystem::resize_file(path, size - index_bytes - 40);
+
+    auto const cut = TrainingReader::Open(path);
+    ASSERT_TRUE(cut.has_value());
+    EXPECT_FALSE(cut->Indexed());
+    EXPECT_EQ(cut->Groups(), full->Groups() - 1);
+    EXPECT_LT(cut->TotalRows(), full->TotalRows());
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,83 @@
+//
+// Created by Malik T on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../core/Game.hpp"
+#include "../core/ClassicRules.hpp"
+#include "../core/Judge.hpp"
+#include "../core/ViolationGate.hpp"
+
+using namespace durak::core;
+
+TEST(ViolationGate, Violation_Is_Returned_Not_Printed)
+{
+    Config cfg{.n_players = 2, .deal_up_to = 6, .deck36 = true, .seed = 77ull};
+    GameImpl game(cfg, std::make_unique<ClassicRules>());
+
+    ASSERT_EQ(game.Resolve(AttackAction{}), MoveOutcome::Invalid);
+    ASSERT_TRUE(game.LastViolation().has_value());
+    EXPECT_EQ(game.LastViolation()->code, error::RuleViolationCode::Attack_Empty);
+    EXPECT_EQ(game.LastActor(), game.Attacker());
+
+    // State untouched; the Judge default is always legal and clears the violation
+    auto const fallback = Judge::DefaultAction(game, game.CurrentActor());
+    ASSERT_TRUE(fallback.has_value());
+    EXPECT_EQ(game.Resolve(*fallback), MoveOutcome::Applied);
+    EXPECT_FALSE(game.LastViolation().has_value());
+}
+
+TEST(ViolationGate, Retry_Budget_Per_Seat)
+{
+    ViolationGate gate(2, {}, 2, std::chrono::hours(1));
+    error::RuleViolation const v{.code = error::RuleViolationCode::Pass_TableEmpty};
+
+    EXPECT_EQ(gate.OnViolation(0, v), ViolationGate::Verdict::Retry);
+    EXPECT_EQ(gate.OnViolation(0, v), ViolationGate::Verdict::Retry);
+    EXPECT_EQ(gate.OnViolation(1, v), ViolationGate::Verdict::Retry); // seats don't share a budget
+    EXPECT_EQ(gate.OnViolation(0, v), ViolationGate::Verdict::Forfeit);
+
+    // Forfeit refills the budget, and so does an accepted action
+    EXPECT_EQ(gate.OnViolation(0, v), ViolationGate::Verdict::Retry);
+    gate.OnAccepted(0);
+    EXPECT_EQ(gate.OnViolation(0, v), ViolationGate::Verdict::Retry);
+    EXPECT_EQ(gate.OnViolation(0, v), ViolationGate::Verdict::Retry);
+
+    EXPECT_EQ(gate.Total(0), 6u);
+    EXPECT_EQ(gate.Forfeits(0), 1u);
+    EXPECT_EQ(gate.Total(1), 1u);
+}
+
+// Summaries go to the host's sink, at most once per period, and never from the destructor.
+TEST(ViolationGate, Summaries_Go_To_The_Sink)
+{
+    using namespace std::chrono_literals;
+    std::vector<std::string> lines;
+    error::RuleViolation const v{.code = error::RuleViolationCode::Pass_TableEmpty};
+    ViolationGate::Clock::time_point const t0{};
+    {
+        ViolationGate gate(2, [&](std::string_view const line) { lines.emplace_back(line); }, 3, 5s);
+        gate.OnViolation(1, v, t0 + 10s); // first violation reports at once
+        ASSERT_EQ(lines.size(), 1u);
+        EXPECT_NE(lines[0].find("P1"), std::string::npos) << lines[0];
+
+        gate.OnViolation(0, v, t0 + 11s);
+        gate.OnViolation(0, v, t0 + 12s);
+        EXPECT_EQ(lines.size(), 1u);
+        gate.OnViolation(0, v, t0 + 15s);
+        ASSERT_EQ(lines.size(), 2u);
+        EXPECT_NE(lines[1].find("3 since last report"), std::string::npos) << lines[1];
+
+        gate.OnViolation(1, v, t0 + 16s);
+    }
+    EXPECT_EQ(lines.size(), 2u); // the pending count is dropped with the gate, not printed
+
+    ViolationGate quiet(1); // no sink: counting only
+    quiet.OnViolation(0, v);
+    quiet.Flush();
+    EXPECT_EQ(quiet.Total(0), 1u);
+}
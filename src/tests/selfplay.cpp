@@ -67,7 +67,8 @@ TEST(SelfPlay, Transcripts_And_End)
 
                 // We will log the actual action after Step(), using RecordingPlayer.
                 MoveOutcome const out = game.Step();
-                // durak::core::debug::CheckInvariants(game);
+                auto const fault = durak::core::debug::CheckInvariantsFast(game);
+                ASSERT_EQ(fault, durak::core::debug::InvariantFault::None) << durak::core::debug::to_string(fault);
 
                 // Fetch the action chosen by the actor
                 auto* rec = durak::core::debug::AsRecording(game.PlayerAt(actor));
@@ -67,8 +67,8 @@ TEST(SelfPlay6P, Transcripts_And_End)
 
                 MoveOutcome const out = game.Step();
 
-                // Optional invariant check (enable if you want deeper guarantees)
-                // durak::core::debug::CheckInvariants(game);
+                auto const fault = durak::core::debug::CheckInvariantsFast(game);
+                ASSERT_EQ(fault, durak::core::debug::InvariantFault::None) << durak::core::debug::to_string(fault);
 
                 auto* rec = durak::core::debug::AsRecording(game.PlayerAt(actor));
                 ASSERT_NE(rec, nullptr) << "Player not wrapped with RecordingPlayer";